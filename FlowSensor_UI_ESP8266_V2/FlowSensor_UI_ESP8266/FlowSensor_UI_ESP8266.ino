@@ -2,15 +2,31 @@
 #include <ESP8266mDNS.h>
 #include <LittleFS.h>
 #include "sensors.h"
+#include "runlog.h"
+#include "jsonbuf.h"
+#include "telemetry.h"
+#include "trend.h"
+#include "spectrum.h"
+#include "pid.h"
+#include "events.h"
+#include "totalizer.h"
+#include "udp_push.h"
 #include "web.h"
 
 // Wi-Fi 
 const char* WIFI_SSID = "";
 const char* WIFI_PASS = "";
 const char* MDNS_HOST = "flowssensors";
+const char* NTP_SERVER = "pool.ntp.org";   // Wall-clock start time of runs
+const char* UDP_COLLECTOR = "";            // Telemetry push target (unicast or multicast IP), "" = off
+const uint16_t UDP_PORT = 4210;
 
 // Global sensor enabled state (referenced by sensors.h and web.h)
-bool sensor_enabled[NUM_SENSORS] = { true, true, true, true };
+bool sensor_enabled[NUM_SENSORS];
+
+// Random per boot (referenced by telemetry.h and web.h): telemetry clients
+// see sequence numbers restart with it, and ETags never repeat across resets
+uint32_t boot_id = 0;
 
 static void wifi_connect() {
   WiFi.mode(WIFI_STA);
@@ -25,127 +41,354 @@ static void wifi_connect() {
   if (MDNS.begin(MDNS_HOST)) {
     Serial.printf("[mdns] http://%s.local\n", MDNS_HOST);
   }
+  configTime(0, 0, NTP_SERVER);
+}
+
+// Unix time, or 0 until NTP has set the clock
+static uint32_t clock_unix() {
+  time_t t = time(nullptr);
+  return (t > 1600000000) ? (uint32_t)t : 0;
 }
 
-// Fast sampling 20 Hz
-static const unsigned long SAMPLE_MS = 50;   // 20 Hz
-static unsigned long last_sample_ms = 0;
+// Acquisition at ACQ_RATE_HZ, decimated to 20 Hz (see sensors.h)
+static uint32_t next_acq_us = 0;
+static uint32_t last_read_us = 0;   // micros() when the last read cycle finished
 
-// Data buffers for 4 sensors
+// Rolling windows, all served from the same sample ring @ 20 Hz
+enum StatWindow : uint8_t {
+  WIN_05S = 0,    // Recording average
+  WIN_1S,         // Live value
+  WIN_10S,        // Mean / RMS / CV
+  NUM_WINDOWS
+};
 static const int N10 = 200; // 10 s @ 20 Hz
-static float s_flow_buf[NUM_SENSORS][N10] = {0};
-static float s_temp_buf[NUM_SENSORS][N10] = {0};
+static constexpr int WINDOW_LEN[NUM_WINDOWS] = { 10, 20, N10 };
+
+// Sample ring: raw sensor words, one row per sensor (flow and temperature
+// in separate arrays), converted to mL/min and °C only when reported. The
+// ring is as long as the longest window and keeps 20 s of history in the
+// RAM the old float buffers needed for 10 s.
+static const int N_HIST = 2 * N10;   // 20 s @ 20 Hz
+
+static constexpr bool windows_fit(int w = 0) {
+  return w == NUM_WINDOWS || (WINDOW_LEN[w] <= N_HIST && windows_fit(w + 1));
+}
+static_assert(windows_fit(), "Every window must fit in the sample ring");
+static int16_t s_flow_buf[NUM_SENSORS][N_HIST] = {0};
+static int16_t s_temp_buf[NUM_SENSORS][N_HIST] = {0};
+// Per sample, bit i set when sensor i delivered the value (not held)
+static uint8_t s_ok_hist[N_HIST][TELEM_OK_BYTES] = {{0}};
+// Longer history at 1 s / 10 s / 1 min / 10 min resolution (see trend.h,
+// which sizes it within TREND_RAM_BUDGET)
+static TrendTier s_trend[TREND_TIERS];
+
+// Sample history must leave room for Wi-Fi and the web server
+static const size_t HISTORY_RAM_BUDGET = 32 * 1024;
+static_assert(sizeof(s_flow_buf) + sizeof(s_temp_buf) + sizeof(s_ok_hist) <= HISTORY_RAM_BUDGET,
+              "Sample history does not fit in RAM; reduce the number of sensors or N_HIST");
 static int   buf_idx = -1;
 static int   buf_count = 0;
+static uint32_t s_seq = 0;   // Sample periods since boot, pushed or lost
+static uint32_t s_last_sample_ms = 0;   // millis() of the newest sample
+static uint32_t s_lost = 0;  // Samples a stalled loop() never took
 
-// Sums for mean/RMS calculation
-static double s_sum10[NUM_SENSORS]   = {0};
-static double s_sumsq10[NUM_SENSORS] = {0};
+// Bumped whenever the recording state changes outside a sample tick; with
+// s_seq it identifies the content of a UI snapshot
+static uint32_t ui_state_changes = 0;
+
+// Running sums of raw words per sensor and window, updated in O(1) per
+// sample. Integer sums are exact, so they never drift however long we run
+// and the variance needs no cancellation-prone floating point step.
+struct WindowSums {
+  int32_t flow;
+  int64_t flow_sq;
+  int32_t temp;
+};
+static WindowSums s_win[NUM_SENSORS][NUM_WINDOWS];
 
 // Sensor status
 static bool s_ok[NUM_SENSORS] = {false};
 
+// Dominant flow pulsation per sensor (see spectrum.h). One transform starts
+// every FFT_START_MS, sensors in turn.
+#define FFT_START_MS  1000
+static_assert(FFT_N <= N_HIST, "The FFT window must fit in the sample ring");
+static FftResult s_pulse[NUM_SENSORS];
+static uint8_t fft_sensor = 0;
+static unsigned long last_fft_ms = 0;
+
 // CV guard threshold (mL/min)
 static const float CV_MEAN_EPS = 0.02f;
 
-// Recording to CSV
+// Recording to binary run files (see runlog.h), converted to CSV on download
+static RunWriter run_writer;
+static RunIndexEntry run_index[RUN_INDEX_SLOTS];   // RAM copy of the index file
+static uint32_t run_id      = 0;   // Run being recorded, else the last one
+static uint32_t next_run_id = 1;
 static bool recording   = false;
-static bool csv_ready   = false;
 static unsigned long run_start_ms  = 0;
+static unsigned long run_stop_ms   = 0;
 static unsigned long last_record_ms = 0;
 static const unsigned long RECORD_MS = 500;  // 0.5 s
+static uint32_t streamed_run_id = 0;  // Run open for /history or CSV, kept by make_room()
+
+// Full-rate mode records straight from the sample ring: the recorder trails
+// push_sample() by a sequence number, so a slow flash write only delays it
+// and samples are lost only if it falls a whole ring (20 s) behind.
+static RecordMode record_mode = RECORD_AVG;
+static uint32_t rec_start_seq = 0;    // First sample of the run
+static uint32_t rec_next_seq  = 0;    // Next sample to record
+static uint32_t rec_dropped   = 0;    // Samples overwritten before recording
 
 // Which sensors are recorded (snapshot at start_run)
-static bool record_mask[NUM_SENSORS] = { true, true, true, true };
+static bool record_mask[NUM_SENSORS];
+
+// Triggered captures (see events.h). The window around a trigger stays in
+// the sample ring until well after its last sample is pushed, so nothing
+// is copied: once the post-trigger samples are in, the window is written
+// from the ring, one flash write per loop() pass. One capture at a time;
+// triggers meanwhile are counted as missed.
+static_assert(EVENT_PRE_SAMPLES + EVENT_POST_SAMPLES <= N_HIST,
+              "The event window must fit in the sample ring");
+enum EventState : uint8_t {
+  EVENT_ARMED = 0,   // Waiting for a trigger
+  EVENT_POST,        // Waiting for the post-trigger samples
+  EVENT_WRITING      // Event file open, writing from the ring
+};
+static EventTrigger event_triggers[NUM_SENSORS];
+static bool event_firing[NUM_SENSORS];   // A condition held on the last sample (fire on the edge)
+static EventEntry event_index[EVENT_SLOTS];   // RAM copy of the index file
+static uint32_t next_event_id = 1;
+static uint32_t streamed_event_id = 0;    // Event open for CSV download, not overwritten
+static EventState event_state = EVENT_ARMED;
+static EventEntry event_pending;          // Event being captured
+static uint64_t event_mask = 0;           // Its sensors (enabled at the trigger)
+static uint32_t event_first_seq = 0;      // Its first sample
+static uint32_t event_end_seq   = 0;      // One past its last sample
+static uint32_t event_next_seq  = 0;      // Next sample to write
+static RunWriter event_writer;
+static uint32_t events_missed  = 0;       // Triggers during a capture
+static uint32_t events_skipped = 0;       // Captures not saved (storage full, file error)
 
 // helpers 
-static inline int wrap(int i) { return (i + N10) % N10; }
+static inline int wrap(int i) { return (i + N_HIST) % N_HIST; }
+
+// Ring slot of sample `seq`, which must be one of the last buf_count
+static inline int ring_slot(uint32_t seq) { return wrap(buf_idx - (int)(s_seq - 1 - seq)); }
 
 static void reset_buffers() {
   buf_idx = -1;
   buf_count = 0;
+  memset(s_win, 0, sizeof(s_win));
+  memset(s_ok_hist, 0, sizeof(s_ok_hist));
+  memset(s_trend, 0, sizeof(s_trend));
   for (int i = 0; i < NUM_SENSORS; i++) {
-    s_sum10[i]   = 0;
-    s_sumsq10[i] = 0;
     s_ok[i]      = false;
-    for (int j = 0; j < N10; j++) {
+    for (int j = 0; j < N_HIST; j++) {
       s_flow_buf[i][j] = 0;
       s_temp_buf[i][j] = 0;
     }
   }
 }
 
+// Samples currently covered by a window
+static inline int window_count(StatWindow w) {
+  return min(buf_count, WINDOW_LEN[w]);
+}
+
 static void push_sample(FlowReading readings[]) {
-  int next = (buf_idx + 1) % N10;
+  PERF_SCOPE(PERF_PUSH_SAMPLE);
+  int next = (buf_idx + 1) % N_HIST;
+  memset(s_ok_hist[next], 0, TELEM_OK_BYTES);
+  TrendPoint trend_in[NUM_SENSORS];
   
   for (int i = 0; i < NUM_SENSORS; i++) {
-    float f = readings[i].flow_ml_min;
-    float t = readings[i].temp_c;
+    int16_t f = readings[i].flow_raw;
+    int16_t t = readings[i].temp_raw;
     bool ok = readings[i].ok;
     bool enabled = readings[i].enabled;
 
-    if (buf_count == N10) {
-      s_sum10[i]   -= s_flow_buf[i][next];
-      s_sumsq10[i] -= (double)s_flow_buf[i][next] * s_flow_buf[i][next];
+    if (!(enabled && ok)) {
+      // For disabled or bad readings, hold last value
+      int prev = (buf_idx < 0) ? next : buf_idx;
+      f = s_flow_buf[i][prev];
+      t = s_temp_buf[i][prev];
+    } else {
+      s_ok_hist[next][i / 8] |= 1 << (i % 8);
     }
 
-    if (enabled && ok) {
-      // Normal update
-      s_flow_buf[i][next] = f;
-      s_temp_buf[i][next] = t;
-      s_sum10[i]   += f;
-      s_sumsq10[i] += (double)f * f;
-    } else {
-      // For disabled or bad readings, hold last value; don't modify sums
-      int prev = (buf_idx < 0) ? next : buf_idx;
-      s_flow_buf[i][next] = s_flow_buf[i][prev];
-      s_temp_buf[i][next] = s_temp_buf[i][prev];
+    // Each window drops the sample that falls out of it and adds the new one
+    // (read before the ring slot is overwritten: the longest window evicts
+    // exactly the slot being written)
+    for (int w = 0; w < NUM_WINDOWS; w++) {
+      WindowSums& ws = s_win[i][w];
+      if (buf_count >= WINDOW_LEN[w]) {
+        int old = wrap(next - WINDOW_LEN[w]);
+        int32_t fo = s_flow_buf[i][old];
+        ws.flow    -= fo;
+        ws.flow_sq -= fo * fo;
+        ws.temp    -= s_temp_buf[i][old];
+      }
+      ws.flow    += f;
+      ws.flow_sq += (int32_t)f * f;
+      ws.temp    += t;
     }
 
+    s_flow_buf[i][next] = f;
+    s_temp_buf[i][next] = t;
+    trend_in[i] = { f, f, f, t };
     s_ok[i] = ok;
   }
 
-  if (buf_count < N10) buf_count++;
+  if (buf_count < N_HIST) buf_count++;
   buf_idx = next;
+  s_seq++;
+  s_last_sample_ms = millis();
+  trend_add(s_trend, 0, trend_in, s_last_sample_ms);
 }
 
-static void sample_20hz() {
-  unsigned long now = millis();
-  if (now - last_sample_ms < SAMPLE_MS) return;
-  last_sample_ms = now;
+// Mean raw words of one window, rounded to the nearest word
+static void window_raw_means(StatWindow w, int16_t f_raw[], int16_t t_raw[]) {
+  int n = window_count(w);
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    f_raw[i] = n ? (int16_t)lroundf((float)s_win[i][w].flow / n) : 0;
+    t_raw[i] = n ? (int16_t)lroundf((float)s_win[i][w].temp / n) : 0;
+  }
+}
 
-  FlowReading readings[NUM_SENSORS];
+// Mean flow and temperature of one window
+static void window_means(StatWindow w, float f_avg[], float t_avg[]) {
+  int n = window_count(w);
   for (int i = 0; i < NUM_SENSORS; i++) {
-    readings[i] = read_sensor((uint8_t)(i + 1));
+    f_avg[i] = n ? flow_from_raw(i, (float)s_win[i][w].flow / n) : 0;
+    t_avg[i] = n ? temp_from_raw(i, (float)s_win[i][w].temp / n) : 0;
   }
+}
 
-  push_sample(readings);
+// Coefficient of variation (%) of one sensor's flow over a window
+static float window_cv(int i, StatWindow w) {
+  int n = window_count(w);
+  if (n == 0) return 0.0f;
+  // n^2 * variance = n * sum(x^2) - sum(x)^2, exact in 64-bit integers
+  const WindowSums& ws = s_win[i][w];
+  int64_t n2var = (int64_t)n * ws.flow_sq - (int64_t)ws.flow * ws.flow;
+  double scale = SENSOR_TOPOLOGY[i].flow_scale;
+  double m   = (double)ws.flow / n / scale;
+  double var = (double)max((int64_t)0, n2var) / ((double)n * n) / (scale * scale);
+  return (m < CV_MEAN_EPS) ? 0.0f : (float)(100.0 * sqrt(var) / m);
 }
 
-static void compute_1s_means(float f_1s[], float t_1s[]) {
-  if (buf_count == 0) {
-    for (int i = 0; i < NUM_SENSORS; i++) {
-      f_1s[i] = 0;
-      t_1s[i] = 0;
+// Test the triggers on the newest sample and start a capture on the first
+// condition that became true. A sensor switched on moments ago is not
+// tested until its filter has settled: its samples are not OK yet, but
+// that is no read error.
+static void event_check(const FlowReading readings[]) {
+  uint32_t trigger_seq = s_seq - 1;
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    const EventTrigger& tr = event_triggers[i];
+    if (tr.causes == 0 || !sensor_enabled[i] || readings[i].settling) {
+      event_firing[i] = false;
+      continue;
     }
-    return;
+    float flow = flow_from_raw(i, s_flow_buf[i][buf_idx]);
+    bool has_rate = buf_count >= 2 && (tr.causes & (1 << EVENT_RATE));
+    float rate = has_rate ? (flow - flow_from_raw(i, s_flow_buf[i][wrap(buf_idx - 1)])) * 1000.0f / SAMPLE_MS : 0.0f;
+    bool has_cv = buf_count >= N10 && (tr.causes & (1 << EVENT_CV));
+    float cv = has_cv ? window_cv(i, WIN_10S) : 0.0f;
+    float value;
+    EventCause cause = event_evaluate(tr, readings[i].ok, flow, has_rate, rate, has_cv, cv, value);
+    bool edge = cause != EVENT_NONE && !event_firing[i];
+    event_firing[i] = cause != EVENT_NONE;
+    if (!edge) continue;
+
+    if (event_state != EVENT_ARMED) {
+      events_missed++;
+      continue;
+    }
+    memset(&event_pending, 0, sizeof(event_pending));
+    event_pending.start_unix = clock_unix();
+    event_pending.value      = value;
+    event_pending.sensor     = i;
+    event_pending.cause      = cause;
+    // Right after boot the ring may hold less than the pre-trigger window
+    event_first_seq = trigger_seq + 1 - min((uint32_t)EVENT_PRE_SAMPLES, (uint32_t)buf_count);
+    event_end_seq   = trigger_seq + 1 + EVENT_POST_SAMPLES;
+    event_pending.trigger_ms = (trigger_seq - event_first_seq) * SAMPLE_MS;
+    event_mask = 0;
+    for (int k = 0; k < NUM_SENSORS; k++) {
+      if (sensor_enabled[k]) event_mask |= 1ULL << k;
+    }
+    event_state = EVENT_POST;
+    Serial.printf("[event] Sensor %d: %s (%.3f)\n", i + 1, EVENT_CAUSE_NAMES[cause], value);
   }
-  int n = min(buf_count, 20); // 1 s @ 20 Hz
-  
-  for (int i = 0; i < NUM_SENSORS; i++) {
-    double sf = 0, st = 0;
-    for (int j = 0; j < n; j++) {
-      int idx = wrap(buf_idx - j);
-      sf += s_flow_buf[i][idx]; 
-      st += s_temp_buf[i][idx];
+}
+
+// Account for `n` sample periods a stalled loop() never sampled. They keep
+// their sequence numbers, so raw recording, telemetry and captures see them
+// as lost samples and timestamps derived from s_seq stay on time; the ring
+// only holds consecutive samples, so it starts over after them.
+static void skip_samples(uint32_t n) {
+  reset_buffers();
+  s_seq  += n;
+  s_lost += n;
+  if (recording) run_writer.mark_gap();
+}
+
+// Tick the acquisition engine every ACQ_PERIOD_US and push each decimated
+// 20 Hz sample; the bus work itself is spread over loop() passes by
+// acq_step() so web_loop() is never starved.
+static void sample_20hz() {
+  uint32_t now = micros();
+  if ((int32_t)(now - next_acq_us) >= 0) {
+    next_acq_us += ACQ_PERIOD_US;
+    // Fell more than a period behind (long web request): resync, don't
+    // burst. Whole sample periods missed in the stall are lost samples.
+    if ((int32_t)(now - next_acq_us) >= 0) {
+      uint32_t missed = (now - next_acq_us) / ACQ_PERIOD_US + 1;
+      if (missed >= ACQ_DECIMATION) skip_samples(missed / ACQ_DECIMATION);
+      next_acq_us = now + ACQ_PERIOD_US;
+    }
+
+    total_tick(_acq.raw, now);   // Reads of the period that just ended
+    if (acq_tick()) {
+      push_sample(_acq.output);
+      pid_update(_acq.output, last_read_us);   // Control right on the sample tick
+      event_check(_acq.output);
     }
-    f_1s[i] = sf / n; 
-    t_1s[i] = st / n;
   }
+
+  if (acq_step()) last_read_us = micros();
+}
+
+// One slice of the pulsation analysis per loop() pass
+static void spectrum_step() {
+  if (_fft.state == FFT_IDLE) {
+    if (buf_count < FFT_N || millis() - last_fft_ms < FFT_START_MS) return;
+    last_fft_ms = millis();
+    if (!sensor_enabled[fft_sensor]) {
+      s_pulse[fft_sensor] = { 0.0f, 0.0f };
+      fft_sensor = (fft_sensor + 1) % NUM_SENSORS;
+      return;
+    }
+    PERF_SCOPE(PERF_FFT);
+    fft_load(s_flow_buf[fft_sensor], N_HIST, buf_idx);
+    return;
+  }
+  PERF_SCOPE(PERF_FFT);
+  if (fft_step()) {
+    s_pulse[fft_sensor] = _fft.result;
+    fft_sensor = (fft_sensor + 1) % NUM_SENSORS;
+  }
+}
+
+static void compute_1s_means(float f_1s[], float t_1s[]) {
+  PERF_SCOPE(PERF_MEANS_1S);
+  window_means(WIN_1S, f_1s, t_1s);
 }
 
 static void compute_10s_metrics(float mean10[], float rms10[], float cv10[]) {
-  int n = buf_count; 
+  PERF_SCOPE(PERF_METRICS_10S);
+  int n = window_count(WIN_10S);
   if (n == 0) { 
     for (int i = 0; i < NUM_SENSORS; i++) {
       mean10[i] = 0;
@@ -156,124 +399,430 @@ static void compute_10s_metrics(float mean10[], float rms10[], float cv10[]) {
   }
   
   for (int i = 0; i < NUM_SENSORS; i++) {
-    double m = s_sum10[i] / n;
-    double r = sqrt(max(0.0, s_sumsq10[i] / n));
+    const WindowSums& ws = s_win[i][WIN_10S];
+    double scale = SENSOR_TOPOLOGY[i].flow_scale;
+    mean10[i] = (double)ws.flow / n / scale;
+    rms10[i]  = sqrt((double)ws.flow_sq / n) / scale;
+    cv10[i]   = window_cv(i, WIN_10S);
+  }
+}
 
-    if (m < CV_MEAN_EPS) {
-      cv10[i] = 0.0;
-    } else {
-      cv10[i] = 100.0 * sqrt(max(0.0, r*r - m*m)) / m;
+// Storage - keep at least 10% free
+static const float STORAGE_MAX_PCT = 90.0f;
+
+static float storage_used_pct() {
+  FSInfo fs_info;
+  LittleFS.info(fs_info);
+  return (float)fs_info.usedBytes / fs_info.totalBytes * 100.0;
+}
+
+static void runs_begin() {
+  LittleFS.mkdir(RUN_DIR);
+  LittleFS.remove("/last_run.bin");   // Single-run file of earlier firmware
+  run_index_load(run_index);
+  for (int s = 0; s < RUN_INDEX_SLOTS; s++) {
+    uint32_t id = run_index[s].id;
+    if (id == 0) continue;
+    if (run_index_slot(id) != s) {
+      memset(&run_index[s], 0, sizeof(RunIndexEntry));   // Not a valid entry
+      continue;
     }
+    if (id >= next_run_id) next_run_id = id + 1;
+    if (id > run_id) run_id = id;
+  }
+  Serial.printf("[run] Index: next run %u\n", next_run_id);
+}
 
-    mean10[i] = m; 
-    rms10[i]  = r;
+// Newest run that is not being recorded, 0 if none
+static uint32_t latest_run_id() {
+  uint32_t latest = 0;
+  for (int s = 0; s < RUN_INDEX_SLOTS; s++) {
+    uint32_t id = run_index[s].id;
+    if (id == 0 || (recording && id == run_id)) continue;
+    if (id > latest) latest = id;
   }
+  return latest;
 }
 
-// Storage check - stop if less than 10% free space
-static bool check_storage_available() {
-  FSInfo fs_info;
-  LittleFS.info(fs_info);
-  size_t used = fs_info.usedBytes;
-  size_t total = fs_info.totalBytes;
-  float percent_used = (float)used / total * 100.0;
-  
-  if (percent_used > 90.0) {
-    Serial.printf("[storage] WARNING: %.1f%% full, stopping recording\n", percent_used);
-    return false;
+// Write back the index entry in `slot`; the RAM copy is kept either way
+static bool run_store(uint8_t slot) {
+  if (run_index_store(run_index, slot)) return true;
+  Serial.printf("[run] Index write failed (slot %u)\n", slot);
+  return false;
+}
+
+static void delete_run(uint32_t id) {
+  char path[32];
+  run_path(path, sizeof(path), id);
+  LittleFS.remove(path);
+  uint8_t slot = run_index_slot(id);
+  memset(&run_index[slot], 0, sizeof(RunIndexEntry));
+  run_store(slot);
+  ui_state_changes++;
+  Serial.printf("[storage] Deleted run %u\n", id);
+}
+
+// Evict the oldest runs until storage is below STORAGE_MAX_PCT; false if
+// only the run being recorded is left and storage is still full
+static bool make_room() {
+  float pct;
+  while ((pct = storage_used_pct()) > STORAGE_MAX_PCT) {
+    uint32_t oldest = 0;
+    for (int s = 0; s < RUN_INDEX_SLOTS; s++) {
+      uint32_t id = run_index[s].id;
+      if (id == 0 || (recording && id == run_id) || id == streamed_run_id) continue;
+      if (oldest == 0 || id < oldest) oldest = id;
+    }
+    if (oldest == 0) {
+      Serial.printf("[storage] WARNING: %.1f%% full, stopping recording\n", pct);
+      return false;
+    }
+    delete_run(oldest);
   }
   return true;
 }
 
-// Recording 0.5 s to LittleFS 
-void start_run() {
-  // Check storage availability
-  if (!check_storage_available()) {
+// One record: timestamp plus flow/temp words of the sensors in this run
+static void append_record(uint32_t t_ms, const int16_t f[], const int16_t t[], int stride) {
+  int16_t words[RUN_WORDS_MAX];
+  int n = 0;
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    if (!record_mask[i]) continue;
+    words[n++] = f[i * stride];
+    words[n++] = t[i * stride];
+  }
+  run_writer.append_record(t_ms, words);
+}
+
+// Copy samples from the ring until caught up, stopping after one flash
+// write so a single pass never blocks for more than one block
+static void record_raw_samples() {
+  uint32_t behind = s_seq - rec_next_seq;
+  if (behind > (uint32_t)buf_count) {
+    rec_dropped += behind - buf_count;
+    rec_next_seq = s_seq - buf_count;
+    run_writer.mark_gap();
+  }
+
+  uint32_t writes = run_writer.writes;
+  while (rec_next_seq != s_seq && run_writer.writes == writes) {
+    int idx = ring_slot(rec_next_seq);
+    uint32_t t_ms = (rec_next_seq - rec_start_seq) * SAMPLE_MS;
+    append_record(t_ms, &s_flow_buf[0][idx], &s_temp_buf[0][idx], N_HIST);
+    rec_next_seq++;
+  }
+}
+
+// Sync the run file and journal its last complete record
+static void checkpoint_run() {
+  run_writer.sync();
+  RunJournal j = { RUN_JOURNAL_MAGIC, run_id, run_writer.flushed_end,
+                   run_writer.flushed_records, run_writer.flushed_t_ms };
+  run_journal_store(j);
+}
+
+// Continue a run that was cut short by a reset: cut the file back to the
+// journaled record boundary and keep appending after a gap marker
+static void recover_run() {
+  RunJournal j;
+  if (!run_journal_load(j)) return;
+
+  uint8_t slot = run_index_slot(j.run_id);
+  RunIndexEntry& e = run_index[slot];
+  if (e.id == j.run_id && e.bytes) {
+    // Stopped: the reset came before the journal was cleared
+    run_journal_clear();
+    return;
+  }
+  char path[32];
+  run_path(path, sizeof(path), j.run_id);
+  File f = LittleFS.open(path, "r+");
+  RunFileHeader h;
+  RunScale scales[NUM_SENSORS];
+  bool ok = e.id == j.run_id && f && run_read_header(f, h, scales) &&
+            h.num_sensors == NUM_SENSORS && j.end >= run_data_offset(h.num_sensors) &&
+            f.truncate(j.end);
+  if (f) f.close();
+  if (!ok || !run_writer.resume(path, h, j.end, j.records, j.t_ms)) {
+    Serial.printf("[run] Journal for run %u unusable, discarded\n", j.run_id);
+    run_journal_clear();
+    return;
+  }
+
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    record_mask[i] = (h.sensor_mask >> i) & 1;
+  }
+  record_mode = (RecordMode)e.mode;
+  run_id = j.run_id;
+  recording = true;
+  // Timestamps continue one record after the checkpoint
+  run_start_ms = millis() - (j.t_ms + e.record_ms);
+  last_record_ms = 0;
+  rec_start_seq = s_seq - (j.t_ms / SAMPLE_MS + 1);
+  rec_next_seq  = s_seq;
+  rec_dropped   = 0;
+  ui_state_changes++;
+  Serial.printf("[run] Resumed run %u after reset (%u records kept)\n", run_id, j.records);
+}
+
+// Recording 0.5 s means or every 20 Hz sample to LittleFS
+void start_run(RecordMode mode) {
+  if (recording) return;
+
+  // The index is a ring: the new run takes the slot of the oldest one
+  uint32_t id = next_run_id;
+  uint8_t slot = run_index_slot(id);
+  if (run_index[slot].id) delete_run(run_index[slot].id);
+
+  if (!make_room()) {
     Serial.println("[run] Cannot start - storage nearly full");
     return;
   }
 
   // Snapshot which sensors are currently enabled for this run
+  unsigned long record_ms = (mode == RECORD_RAW) ? SAMPLE_MS : RECORD_MS;
+  RunFileHeader h = { RUN_MAGIC, RUN_VERSION, NUM_SENSORS, (uint16_t)record_ms, 0 };
   for (int i = 0; i < NUM_SENSORS; i++) {
     record_mask[i] = sensor_enabled[i];
+    if (record_mask[i]) h.sensor_mask |= (1ULL << i);
   }
 
-  LittleFS.remove("/last_run.csv");
-  File f = LittleFS.open("/last_run.csv", "w");
-  if (f) {
-    // Always write header for all 4 sensors
-    f.print("time_s");
-    for (int i = 0; i < NUM_SENSORS; i++) {
-      int sn = i + 1;
-      f.printf(",s%d_flow_ml_min,s%d_temp_c", sn, sn);
-    }
-    f.println();
-    f.close();
+  // The file stays open for the whole run
+  char path[32];
+  run_path(path, sizeof(path), id);
+  run_writer.close();
+  if (!run_writer.open(path, h)) {
+    Serial.println("[run] Cannot start - failed to create run file");
+    return;
+  }
+
+  RunIndexEntry& e = run_index[slot];
+  memset(&e, 0, sizeof(e));
+  e.id          = id;
+  e.sensor_mask = h.sensor_mask;
+  e.start_unix  = clock_unix();
+  e.record_ms   = h.record_ms;
+  e.mode        = mode;
+  if (!run_store(slot)) {
+    // Recovery could not find the run after a reset
+    Serial.println("[run] Cannot start - failed to write the run index");
+    memset(&e, 0, sizeof(e));
+    run_writer.close();
+    LittleFS.remove(path);
+    return;
   }
+  run_id = id;
+  next_run_id++;
+  checkpoint_run();
 
-  csv_ready   = false;
   recording   = true;
+  record_mode = mode;
   run_start_ms = millis();
   last_record_ms = 0;
+  rec_start_seq = s_seq;
+  rec_next_seq  = s_seq;
+  rec_dropped   = 0;
+  ui_state_changes++;
 
-  Serial.println("[run] START recording");
+  Serial.printf("[run] START run %u (%s)\n", id, (mode == RECORD_RAW) ? "20 Hz raw" : "0.5 s avg");
 }
 
 void stop_run() {
+  if (!recording) return;
+  // Write out what the recorder still trails behind
+  if (record_mode == RECORD_RAW) {
+    while (rec_next_seq != s_seq) record_raw_samples();
+  }
   recording = false;
-  csv_ready = true; // file has data
-  Serial.println("[run] STOP recording; CSV ready");
+  run_stop_ms = millis();
+  run_writer.close();
+  ui_state_changes++;
+
+  // Index entry first, journal last: a reset in between leaves a finished
+  // entry with the journal, which recover_run() discards, and a reset
+  // before it resumes the run from its last checkpoint
+  uint8_t slot = run_index_slot(run_id);
+  RunIndexEntry& e = run_index[slot];
+  e.duration_ms = run_stop_ms - run_start_ms;
+  e.bytes       = run_writer.bytes;
+  e.records     = run_writer.records;
+  run_store(slot);
+  run_journal_clear();
+
+  Serial.printf("[run] STOP run %u; CSV ready (%u records, %u bytes, %.2fx compression, %u flash writes, %u dropped)\n",
+                run_id, run_writer.records, run_writer.bytes, run_writer.compression_ratio(NUM_SENSORS),
+                run_writer.writes, rec_dropped);
 }
 
 static void record_if_due() {
   if (!recording) return;
+  PERF_SCOPE(PERF_RECORD);
   
-  // Check storage every 10 seconds
-  static unsigned long last_storage_check = 0;
+  // Check storage and checkpoint the run every RUN_CHECKPOINT_MS
+  static unsigned long last_checkpoint_ms = 0;
   unsigned long now = millis();
-  if (now - last_storage_check > 10000) {
-    last_storage_check = now;
-    if (!check_storage_available()) {
+  if (now - last_checkpoint_ms > RUN_CHECKPOINT_MS) {
+    last_checkpoint_ms = now;
+    if (!make_room()) {
       stop_run();
       return;
     }
+    checkpoint_run();
   }
   
+  if (record_mode == RECORD_RAW) {
+    record_raw_samples();
+    return;
+  }
+
   if (now - last_record_ms < RECORD_MS) return;
   last_record_ms = now;
 
-  int n = min(buf_count, 10); // ~0.5 s @ 20 Hz
-  if (n == 0) return;
-  
-  double f_avg[NUM_SENSORS] = {0};
-  double t_avg[NUM_SENSORS] = {0};
+  if (buf_count == 0) return;
 
-  for (int i = 0; i < NUM_SENSORS; i++) {
-    for (int j = 0; j < n; j++){
-      int idx = wrap(buf_idx - j);
-      f_avg[i] += s_flow_buf[i][idx]; 
-      t_avg[i] += s_temp_buf[i][idx];
+  int16_t f_avg[NUM_SENSORS];
+  int16_t t_avg[NUM_SENSORS];
+  window_raw_means(WIN_05S, f_avg, t_avg);
+  append_record(now - run_start_ms, f_avg, t_avg, 1);
+}
+
+static void events_begin() {
+  LittleFS.mkdir(EVENT_DIR);
+  event_index_load(event_index);
+  for (int s = 0; s < EVENT_SLOTS; s++) {
+    uint32_t id = event_index[s].id;
+    if (id == 0) continue;
+    if (event_index_slot(id) != s) {
+      memset(&event_index[s], 0, sizeof(EventEntry));   // Not a valid entry
+      continue;
     }
-    f_avg[i] /= n; 
-    t_avg[i] /= n;
+    if (id >= next_event_id) next_event_id = id + 1;
   }
+  Serial.printf("[event] Index: next event %u\n", next_event_id);
+}
 
-  float t_s = (now - run_start_ms) / 1000.0f;
+static void delete_event(uint32_t id) {
+  char path[32];
+  event_path(path, sizeof(path), id);
+  LittleFS.remove(path);
+  uint8_t slot = event_index_slot(id);
+  memset(&event_index[slot], 0, sizeof(EventEntry));
+  event_index_store(event_index, slot);
+}
+
+// Index entry of an event, kept in RAM even if the index file write fails
+static void event_store(const EventEntry& e) {
+  uint8_t slot = event_index_slot(e.id);
+  event_index[slot] = e;
+  if (!event_index_store(event_index, slot)) {
+    Serial.printf("[event] Index write failed for event %u\n", e.id);
+  }
+}
 
-  File f = LittleFS.open("/last_run.csv", "a");
-  if (f) {
-    f.printf("%.1f", t_s);
+// Give up on the capture in progress: its file is removed, and its entry
+// is kept marked unsaved so /events still reports the trigger
+static void event_abandon(const char* why) {
+  Serial.printf("[event] Event %u not saved - %s\n", event_pending.id, why);
+  event_writer.close();
+  char path[32];
+  event_path(path, sizeof(path), event_pending.id);
+  LittleFS.remove(path);
+  event_pending.bytes   = 0;
+  event_pending.records = 0;
+  event_pending.unsaved = 1;
+  event_store(event_pending);
+  events_skipped++;
+  event_state = EVENT_ARMED;
+}
+
+// Save a triggered capture once its window is in the ring: create the file
+// on one pass, then append records until one flash write has been issued
+static void events_loop() {
+  if (event_state == EVENT_ARMED) return;
+  if (event_state == EVENT_POST && (int32_t)(s_seq - event_end_seq) < 0) return;
+  PERF_SCOPE(PERF_EVENTS);
+
+  if (event_state == EVENT_POST) {
+    // The index is a ring: the new event takes the slot of the oldest one,
+    // once that one is no longer being downloaded
+    uint32_t id = next_event_id;
+    uint8_t slot = event_index_slot(id);
+    if (event_index[slot].id && event_index[slot].id == streamed_event_id) return;
+    next_event_id++;
+    if (event_index[slot].id) delete_event(event_index[slot].id);
+    event_pending.id = id;
+
+    char path[32];
+    event_path(path, sizeof(path), id);
+    RunFileHeader h = { RUN_MAGIC, RUN_VERSION, NUM_SENSORS, SAMPLE_MS, event_mask };
+    if (storage_used_pct() > STORAGE_MAX_PCT) {
+      event_abandon("storage full");
+      return;
+    }
+    if (!event_writer.open(path, h)) {
+      event_abandon("cannot create file");
+      return;
+    }
+    event_next_seq = event_first_seq;
+    event_state = EVENT_WRITING;
+    return;
+  }
+
+  // Only if writing stalled for a whole ring
+  if ((int32_t)(event_next_seq - (s_seq - buf_count)) < 0) {
+    event_abandon("fell out of the ring");
+    return;
+  }
+
+  uint32_t writes = event_writer.writes;
+  while (event_next_seq != event_end_seq && event_writer.writes == writes) {
+    int idx = ring_slot(event_next_seq);
+    int16_t words[RUN_WORDS_MAX];
+    int n = 0;
     for (int i = 0; i < NUM_SENSORS; i++) {
-      // Write all 4 sensors, but use empty cells if disabled at start
-      if (record_mask[i]) {
-        f.printf(",%.3f,%.1f", f_avg[i], t_avg[i]);
-      } else {
-        f.print(",,");  // Empty cells for disabled sensor
-      }
+      if (!(event_mask & (1ULL << i))) continue;
+      words[n++] = s_flow_buf[i][idx];
+      words[n++] = s_temp_buf[i][idx];
     }
-    f.println();
-    f.close();
+    event_writer.append_record((event_next_seq - event_first_seq) * SAMPLE_MS, words);
+    event_next_seq++;
+  }
+  if (event_writer.failed) {
+    event_abandon("flash write failed");
+    return;
+  }
+  if (event_next_seq != event_end_seq) return;
+
+  event_writer.close();   // Writes the last block
+  if (event_writer.failed) {
+    event_abandon("flash write failed");
+    return;
+  }
+  event_pending.bytes   = event_writer.bytes;
+  event_pending.records = event_writer.records;
+  event_store(event_pending);
+  event_state = EVENT_ARMED;
+  Serial.printf("[event] Saved event %u (%u records, %u bytes)\n",
+                event_pending.id, event_writer.records, event_writer.bytes);
+}
+
+// Persist the volume totals every TOTAL_CHECKPOINT_MS while they change
+static void total_checkpoint_if_due() {
+  static unsigned long last_total_ms = 0;
+  if (!_total.dirty || millis() - last_total_ms < TOTAL_CHECKPOINT_MS) return;
+  last_total_ms = millis();
+  if (!total_checkpoint()) Serial.println("[total] Checkpoint failed");
+}
+
+// Zero the total of one sensor, or of all with sensor 0, and persist it
+// right away
+void reset_total(uint8_t sensor) {
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    if (sensor == 0 || sensor == i + 1) total_reset(i, clock_unix());
   }
+  total_checkpoint();
+  ui_state_changes++;
+  Serial.printf("[total] Reset %s\n", sensor ? "one sensor" : "all sensors");
 }
 
 // API snapshot for web.h 
@@ -289,42 +838,330 @@ void get_ui_snapshot(
     s_ok_out[i] = s_ok[i];
   }
   is_recording = recording; 
-  is_csv_ready = csv_ready;
+  is_csv_ready = latest_run_id() != 0;
+}
+
+// Changes with every sample and every recording state change, so web.h
+// can reuse a serialised snapshot while it is unchanged
+uint32_t get_snapshot_id() {
+  return s_seq + ui_state_changes;
+}
+
+// Samples lost to loop() stalls since boot, for /perf
+uint32_t get_samples_lost() { return s_lost; }
+
+// Recorder throughput for web.h: sustained bytes/s since the run started
+void get_run_stats(uint8_t& mode, uint32_t& bytes_per_s, uint32_t& dropped, float& compression) {
+  unsigned long elapsed = (recording ? millis() : run_stop_ms) - run_start_ms;
+  mode = record_mode;
+  bytes_per_s = elapsed ? (uint32_t)((uint64_t)run_writer.bytes * 1000 / elapsed) : 0;
+  dropped = rec_dropped;
+  compression = run_writer.compression_ratio(NUM_SENSORS);
+}
+
+// Index entry of a run for web.h, with live figures for the active run
+bool get_run_entry(uint32_t id, RunIndexEntry& e) {
+  if (id == 0) return false;
+  e = run_index[run_index_slot(id)];
+  if (e.id != id) return false;
+  if (recording && id == run_id) {
+    e.duration_ms = millis() - run_start_ms;
+    e.bytes       = run_writer.bytes;
+    e.records     = run_writer.records;
+  }
+  return true;
+}
+
+uint32_t get_next_run_id() { return next_run_id; }
+
+// Dominant pulsation for web.h: frequency (Hz) and amplitude (mL/min)
+void get_pulsation(float hz[], float amp[]) {
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    hz[i]  = s_pulse[i].hz;
+    amp[i] = flow_from_raw(i, s_pulse[i].amp_raw);
+  }
+}
+
+// Index entry of an event for web.h
+bool get_event_entry(uint32_t id, EventEntry& e) {
+  if (id == 0) return false;
+  e = event_index[event_index_slot(id)];
+  return e.id == id;
+}
+
+uint32_t get_next_event_id() { return next_event_id; }
+
+// Trigger configuration of one sensor for web.h
+const EventTrigger& get_event_trigger(uint8_t sensor) { return event_triggers[sensor]; }
+
+void set_event_trigger(uint8_t sensor, const EventTrigger& tr) {
+  event_triggers[sensor] = tr;
+  event_firing[sensor] = false;
+}
+
+// Capture counters for web.h: triggers missed during a capture and
+// captures that could not be saved
+void get_event_stats(uint32_t& missed, uint32_t& skipped) {
+  missed  = events_missed;
+  skipped = events_skipped;
 }
 
-bool stream_csv_to_client(ESP8266WebServer& server) {
-  File f = LittleFS.open("/last_run.csv", "r");
+// One trend tier for web.h
+const TrendTier& get_trend(uint8_t tier) { return s_trend[tier]; }
+
+// Samples still in the ring, for telemetry.h
+void get_sample_range(SampleRange& r) {
+  r.next      = s_seq;
+  r.first     = s_seq - buf_count;
+  r.newest_ms = s_last_sample_ms;
+}
+
+// Telemetry record (see telemetry.h) of a sample in get_sample_range()
+size_t get_telemetry_record(uint32_t seq, uint8_t* out) {
+  int idx = ring_slot(seq);
+  memcpy(out, s_ok_hist[idx], TELEM_OK_BYTES);
+  uint8_t* p = out + TELEM_OK_BYTES;
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    memcpy(p,     &s_flow_buf[i][idx], 2);
+    memcpy(p + 2, &s_temp_buf[i][idx], 2);
+    p += 4;
+  }
+  return TELEM_RECORD_SIZE;
+}
+
+// Open a finished run for reading, positioned at its first record; id 0
+// is the latest
+static bool open_finished_run(uint32_t& id, File& f, RunFileHeader& h, RunScale scales[]) {
+  if (id == 0) id = latest_run_id();
+  if (id == 0 || (recording && id == run_id) || run_index[run_index_slot(id)].id != id) return false;
+  char path[32];
+  run_path(path, sizeof(path), id);
+  f = LittleFS.open(path, "r");
   if (!f) return false;
+  if (!run_read_header(f, h, scales)) {
+    f.close();
+    return false;
+  }
+  return true;
+}
+
+// Decode an open run-format file to CSV while sending it, then close it.
+// Acquisition, recording and event capture are stepped between records, as
+// for /history: a slow client downloading a long run loses no samples.
+static void send_csv(ESP8266WebServer& server, File& f, const RunFileHeader& h,
+                     const RunScale scales[], const char* filename) {
   server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-  server.sendHeader("Content-Disposition", "attachment; filename=flow_data.csv");
+  char disposition[48];
+  snprintf(disposition, sizeof(disposition), "attachment; filename=%s", filename);
+  server.sendHeader("Content-Disposition", disposition);
   server.send(200, "text/csv", "");
-  while (f.available()) {
-    uint8_t buf[512];
-    size_t n = f.read(buf, sizeof(buf));
-    server.sendContent_P((const char*)buf, n);
-    yield();
+
+  // Rows are formatted into one buffer and sent in blocks; a row is at
+  // most 20 chars per sensor, the header line 30
+  const size_t ROW_MAX = 16 + 30 * NUM_SENSORS;
+  static char out[(3 * ROW_MAX > 1024) ? 3 * ROW_MAX : 1024];
+  size_t len = run_csv_header(out, sizeof(out), h);
+
+  static RunDecoder dec;
+  dec.begin(f, h);
+  uint32_t t_ms;
+  int16_t words[RUN_WORDS_MAX];
+  while (dec.next(t_ms, words)) {
+    sample_20hz();
+    record_if_due();
+    events_loop();
+    if (len + 2 * ROW_MAX > sizeof(out)) {
+      server.sendContent_P(out, len);
+      len = 0;
+      yield();
+    }
+    if (dec.gap) len += run_csv_row(out + len, sizeof(out) - len, t_ms, nullptr, h, scales);
+    len += run_csv_row(out + len, sizeof(out) - len, t_ms, words, h, scales);
   }
+  if (len) server.sendContent_P(out, len);
   f.close();
+}
+
+// Decode a finished run file to CSV while sending it; id 0 is the latest
+bool stream_csv_to_client(ESP8266WebServer& server, uint32_t id) {
+  File f;
+  RunFileHeader h;
+  RunScale scales[NUM_SENSORS];
+  if (!open_finished_run(id, f, h, scales)) return false;
+  char name[24];
+  snprintf(name, sizeof(name), "run_%u.csv", id);
+  streamed_run_id = id;
+  send_csv(server, f, h, scales, name);
+  streamed_run_id = 0;
+  return true;
+}
+
+// Send a saved event as CSV; time_s counts from the first pre-trigger
+// sample, the trigger is at trigger_ms
+bool stream_event_csv_to_client(ESP8266WebServer& server, uint32_t id) {
+  EventEntry e;
+  if (!get_event_entry(id, e)) return false;
+  char path[32];
+  event_path(path, sizeof(path), id);
+  File f = LittleFS.open(path, "r");
+  if (!f) return false;
+  RunFileHeader h;
+  RunScale scales[NUM_SENSORS];
+  if (!run_read_header(f, h, scales)) {
+    f.close();
+    return false;
+  }
+  char name[24];
+  snprintf(name, sizeof(name), "event_%u.csv", id);
+  streamed_event_id = id;
+  send_csv(server, f, h, scales, name);
+  streamed_event_id = 0;
+  return true;
+}
+
+// Downsample a finished run for charting: the records from from_ms to
+// to_ms fall into at most `points` equal time buckets, sent as JSON
+//   {"run":3,"from_ms":0,"to_ms":60000,"bucket_ms":300,"sensors":[1,2],
+//    "buckets":[[t_ms,n,[flow_min,flow_mean,flow_max,temp_mean],...],...]}
+// with one array per recorded sensor; buckets without records are left
+// out. The file is decoded one block at a time and acquisition, recording
+// and event capture are stepped between records, so charting a long run
+// never stalls sampling or loses samples from a raw recording.
+bool stream_history_to_client(ESP8266WebServer& server, uint32_t id,
+                              uint32_t from_ms, uint32_t to_ms, uint16_t points) {
+  File f;
+  RunFileHeader h;
+  RunScale scales[NUM_SENSORS];
+  if (points == 0 || !open_finished_run(id, f, h, scales)) return false;
+
+  uint32_t end_ms = min(to_ms, run_index[run_index_slot(id)].duration_ms);
+  if (end_ms < from_ms) end_ms = from_ms;
+  uint32_t span = end_ms - from_ms + 1;
+  uint32_t bucket_ms = max((span + points - 1) / points, (uint32_t)h.record_ms);
+
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+
+  // One bucket is at most 30 chars per sensor plus its time and count
+  const size_t BUCKET_JSON_MAX = 24 + 40 * NUM_SENSORS;
+  static char out[(2 * BUCKET_JSON_MAX > 1024) ? 2 * BUCKET_JSON_MAX : 1024];
+  JsonBuf j(out, sizeof(out));
+  j.raw("{\"run\":");
+  j.u32(id);
+  j.raw(",\"from_ms\":");
+  j.u32(from_ms);
+  j.raw(",\"to_ms\":");
+  j.u32(end_ms);
+  j.raw(",\"bucket_ms\":");
+  j.u32(bucket_ms);
+  j.raw(",\"sensors\":[");
+  bool first = true;
+  for (int i = 0; i < h.num_sensors; i++) {
+    if (!(h.sensor_mask & (1ULL << i))) continue;
+    if (!first) j.ch(',');
+    j.u32(i + 1);
+    first = false;
+  }
+  j.raw("],\"buckets\":[");
+
+  static RunBucket b;
+  uint8_t words = 2 * run_mask_count(h.sensor_mask);
+  auto emit = [&]() {
+    if (b.n == 0) return;
+    if (j.len + BUCKET_JSON_MAX > sizeof(out)) {
+      server.sendContent(out, j.len);
+      j.len = 0;
+    }
+    if (!first) j.ch(',');
+    first = false;
+    j.ch('[');
+    j.u32(b.t_ms);
+    j.ch(',');
+    j.u32(b.n);
+    uint8_t k = 0;
+    for (int i = 0; i < h.num_sensors; i++) {
+      if (!(h.sensor_mask & (1ULL << i))) continue;
+      j.raw(",[");
+      j.fixed(b.lo[k] / scales[i].flow, 3);
+      j.ch(',');
+      j.fixed(b.mean(k) / scales[i].flow, 3);
+      j.ch(',');
+      j.fixed(b.hi[k] / scales[i].flow, 3);
+      j.ch(',');
+      j.fixed(b.mean(k + 1) / scales[i].temp, 1);
+      j.ch(']');
+      k += 2;
+    }
+    j.ch(']');
+  };
+
+  static RunDecoder dec;
+  dec.begin(f, h);
+  streamed_run_id = id;
+  first = true;
+  b.reset(from_ms);
+  uint32_t t_ms;
+  int16_t w[RUN_WORDS_MAX];
+  while (dec.next(t_ms, w)) {
+    sample_20hz();
+    record_if_due();
+    events_loop();
+    if (t_ms < from_ms) continue;
+    if (t_ms > to_ms) break;
+    // Records past the end of the index duration join the last bucket
+    uint32_t slot = min((t_ms - from_ms) / bucket_ms, (uint32_t)points - 1);
+    uint32_t start = from_ms + slot * bucket_ms;
+    if (start != b.t_ms) {
+      emit();
+      b.reset(start);
+    }
+    b.add(w, words);
+  }
+  emit();
+  j.raw("]}");
+  server.sendContent(out, j.len);
+  f.close();
+  streamed_run_id = 0;
   return true;
 }
 
 void setup() {
   Serial.begin(115200);
-  Serial.println("\n[boot] ESP8266 Flow Dashboard (4-Sensor)");
+  Serial.printf("\n[boot] ESP8266 Flow Dashboard (%d sensors on %d mux)\n", NUM_SENSORS, NUM_MUXES);
+
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    sensor_enabled[i] = true;
+    record_mask[i]    = true;
+  }
 
+  boot_id = ESP.random();
   wifi_connect();
   if (!LittleFS.begin()) {
     LittleFS.format();
     LittleFS.begin();
   }
+  runs_begin();
+  recover_run();
+  events_begin();
+  total_begin();
   sensors_begin();
   sensors_start();
   web_begin();
   reset_buffers();
+  fft_begin();
+  pid_begin();
+  udp_push_begin(UDP_COLLECTOR, UDP_PORT);
 }
 
 void loop() {
+  uint32_t t0 = micros();
   sample_20hz();      // always sampling
   record_if_due();    // only when recording == true
+  events_loop();      // only while a capture is pending
+  total_checkpoint_if_due();
+  spectrum_step();    // a slice of the pulsation FFT
   web_loop();
+  udp_push_loop();    // only with a UDP_COLLECTOR
+  perf_loop_pass(micros() - t0, ACQ_PERIOD_US);
+  perf_report_if_due();
 }
\ No newline at end of file
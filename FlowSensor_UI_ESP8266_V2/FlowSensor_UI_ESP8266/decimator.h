@@ -0,0 +1,59 @@
+#pragma once
+#include <Arduino.h>
+
+// Fixed-point CIC (cascaded integrator-comb) decimator
+// N integrator stages run at the input rate, N comb stages at the output
+// rate (every R inputs). The result is divided by the filter gain R^N so it
+// comes out in the same units as the input. Integrators use unsigned
+// arithmetic: they are allowed to wrap, the combs undo the wrap exactly as
+// long as the true output fits in 32 bits.
+template <uint8_t N, uint16_t R>
+struct CicDecimator {
+  static constexpr int32_t gain() {
+    int32_t g = 1;
+    for (uint8_t i = 0; i < N; i++) g *= R;
+    return g;
+  }
+  static_assert(N >= 1, "CIC needs at least one stage");
+  static_assert((int64_t)gain() * 32768 < 2147483648LL, "CIC gain too large for 16-bit input in 32-bit arithmetic");
+
+  // Magnitude response at f, given as a fraction of the input rate:
+  // |sin(pi f R) / (R sin(pi f))|^N, 1 at DC
+  static float response(float f) {
+    float x = (float)M_PI * f;
+    if (fabsf(x) < 1e-6f) return 1.0f;
+    float h = fabsf(sinf(x * R) / (R * sinf(x)));
+    return powf(h, N);
+  }
+
+  uint32_t integ[N];
+  uint32_t comb[N];   // Previous input of each comb stage
+
+  void reset() {
+    memset(integ, 0, sizeof(integ));
+    memset(comb, 0, sizeof(comb));
+  }
+
+  // Input-rate update
+  void integrate(int16_t x) {
+    uint32_t v = (uint32_t)(int32_t)x;
+    for (uint8_t i = 0; i < N; i++) {
+      integ[i] += v;
+      v = integ[i];
+    }
+  }
+
+  // Output-rate update, call once every R integrate() calls
+  int16_t decimate() {
+    uint32_t v = integ[N - 1];
+    for (uint8_t i = 0; i < N; i++) {
+      uint32_t d = v - comb[i];
+      comb[i] = v;
+      v = d;
+    }
+    // Round to nearest, symmetric around zero
+    int32_t s = (int32_t)v;
+    int32_t q = (s >= 0) ? (s + gain() / 2) / gain() : -((-s + gain() / 2) / gain());
+    return (int16_t)constrain(q, -32768, 32767);
+  }
+};
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "sensors.h"
+#include "runlog.h"
+
+// --- Triggered captures ---
+// Instead of recording continuously, a trigger per sensor watches every
+// 20 Hz sample for a flow threshold, a rate of change, a high 10 s CV or a
+// read error. When one fires, the EVENT_PRE_SAMPLES before the trigger and
+// the EVENT_POST_SAMPLES after it are written from the sample ring to an
+// event file in the run format (runlog.h), one record per sample, so only
+// the seconds around a dropout reach flash.
+//
+// Events are kept as /events/<id>.bin. /events/index.bin holds EVENT_SLOTS
+// fixed-size entries, event <id> in slot id % EVENT_SLOTS; a new event
+// replaces the oldest one.
+
+#define EVENT_DIR          "/events"
+#define EVENT_INDEX_FILE   "/events/index.bin"
+#define EVENT_SLOTS        16
+#define EVENT_PRE_SAMPLES  100    // 5 s before the trigger (incl. the trigger sample)
+#define EVENT_POST_SAMPLES 100    // 5 s after it
+
+enum EventCause : uint8_t {
+  EVENT_NONE = 0,
+  EVENT_ERROR,     // Sensor read failed
+  EVENT_LOW,       // Flow below the low threshold
+  EVENT_HIGH,      // Flow above the high threshold
+  EVENT_RATE,      // Flow changed faster than the rate limit
+  EVENT_CV,        // 10 s CV above the limit
+};
+
+static const char* const EVENT_CAUSE_NAMES[] = { "none", "error", "low", "high", "rate", "cv" };
+
+// Conditions of one sensor; a cause is armed when its bit (1 << cause) is set
+struct EventTrigger {
+  uint8_t causes;
+  float   low;     // mL/min
+  float   high;    // mL/min
+  float   rate;    // mL/min per second, either direction
+  float   cv;      // %
+};
+
+struct EventEntry {
+  uint32_t id;
+  uint32_t start_unix;     // Wall-clock time of the trigger, 0 if the clock was not set
+  uint32_t bytes;          // Event file size
+  float    value;          // Value that fired: mL/min, mL/min/s or % by cause
+  uint16_t records;
+  uint16_t trigger_ms;     // Time of the trigger sample in the file
+  uint8_t  sensor;         // 0-based
+  uint8_t  cause;          // EventCause
+  uint8_t  unsaved;        // The file could not be written; only the entry is kept
+  uint8_t  reserved;
+};
+
+inline uint8_t event_index_slot(uint32_t id) { return id % EVENT_SLOTS; }
+
+inline void event_path(char* out, size_t cap, uint32_t id) {
+  snprintf(out, cap, EVENT_DIR "/%u.bin", id);
+}
+
+inline void event_index_load(EventEntry entries[EVENT_SLOTS]) {
+  index_file_load(EVENT_INDEX_FILE, entries, sizeof(EventEntry) * EVENT_SLOTS);
+}
+
+inline bool event_index_store(const EventEntry entries[EVENT_SLOTS], uint8_t slot) {
+  return index_file_store(EVENT_INDEX_FILE, entries, sizeof(EventEntry) * EVENT_SLOTS,
+                          slot, sizeof(EventEntry));
+}
+
+// First armed condition that holds for one sample, with the value that
+// fired it. rate and cv are only tested when the caller has them.
+inline EventCause event_evaluate(const EventTrigger& tr, bool ok, float flow,
+                                 bool has_rate, float rate, bool has_cv, float cv, float& value) {
+  auto armed = [&](EventCause c) { return (tr.causes >> c) & 1; };
+  if (!ok) {
+    value = 0.0f;
+    return armed(EVENT_ERROR) ? EVENT_ERROR : EVENT_NONE;
+  }
+  if (armed(EVENT_LOW) && flow < tr.low)   { value = flow; return EVENT_LOW; }
+  if (armed(EVENT_HIGH) && flow > tr.high) { value = flow; return EVENT_HIGH; }
+  if (armed(EVENT_RATE) && has_rate && fabsf(rate) > tr.rate) { value = rate; return EVENT_RATE; }
+  if (armed(EVENT_CV) && has_cv && cv > tr.cv) { value = cv; return EVENT_CV; }
+  return EVENT_NONE;
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+#include <Arduino.h>
+
+// Allocation-free JSON writer over a caller-provided buffer
+// Numbers are formatted with integer arithmetic instead of String/printf.
+// Output that does not fit is dropped and flagged in `overflow`, so a
+// response is either complete or known to be truncated.
+struct JsonBuf {
+  char*  buf;
+  size_t cap;
+  size_t len;
+  bool   overflow;
+
+  JsonBuf(char* b, size_t c) : buf(b), cap(c), len(0), overflow(false) {}
+
+  void raw(const char* s, size_t n) {
+    if (len + n > cap) {
+      overflow = true;
+      return;
+    }
+    memcpy(buf + len, s, n);
+    len += n;
+  }
+
+  void raw(const char* s) { raw(s, strlen(s)); }
+
+  void ch(char c) { raw(&c, 1); }
+
+  void u32(uint32_t v) {
+    char tmp[10];
+    int n = 0;
+    do {
+      tmp[sizeof(tmp) - 1 - n++] = '0' + v % 10;
+      v /= 10;
+    } while (v);
+    raw(tmp + sizeof(tmp) - n, n);
+  }
+
+  void i32(int32_t v) {
+    if (v < 0) {
+      ch('-');
+      u32(0u - (uint32_t)v);
+    } else {
+      u32((uint32_t)v);
+    }
+  }
+
+  // Value rounded to `decimals` places (0..6), like String(v, decimals)
+  void fixed(float v, uint8_t decimals) {
+    static const uint32_t POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+    if (isnan(v) || isinf(v)) {
+      raw("null");   // Not representable in JSON
+      return;
+    }
+    // Integer and fractional part apart: the fraction keeps full float
+    // precision when scaled, a scaled whole value would not
+    uint32_t p = POW10[decimals];
+    float a = fabsf(v);
+    uint32_t ip = (a < 4294967040.0f) ? (uint32_t)a : 4294967040UL;
+    uint32_t f = (uint32_t)((a - ip) * p + 0.5f);
+    if (f >= p) {
+      ip++;
+      f -= p;
+    }
+    if (v < 0 && (ip || f)) ch('-');
+    u32(ip);
+    if (decimals == 0) return;
+    char frac[7];
+    for (int i = decimals - 1; i >= 0; i--) {
+      frac[i] = '0' + f % 10;
+      f /= 10;
+    }
+    ch('.');
+    raw(frac, decimals);
+  }
+
+  // v / 10^decimals (0..6) exactly, for counters kept in integer units
+  void scaled(int64_t v, uint8_t decimals) {
+    static const uint32_t POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+    uint64_t a = (v < 0) ? 0 - (uint64_t)v : (uint64_t)v;
+    uint64_t ip = a / POW10[decimals];
+    uint32_t f = a % POW10[decimals];
+    if (v < 0) ch('-');
+    // Whole part above 2^32 - 1 in two pieces of up to 9 digits
+    if (ip >= 1000000000ULL) {
+      u32((uint32_t)(ip / 1000000000ULL));
+      char tmp[9];
+      uint32_t lo = ip % 1000000000ULL;
+      for (int i = 8; i >= 0; i--, lo /= 10) tmp[i] = '0' + lo % 10;
+      raw(tmp, 9);
+    } else {
+      u32((uint32_t)ip);
+    }
+    if (decimals == 0) return;
+    char frac[7];
+    for (int i = decimals - 1; i >= 0; i--, f /= 10) frac[i] = '0' + f % 10;
+    ch('.');
+    raw(frac, decimals);
+  }
+
+  void boolean(bool b) { raw(b ? "true" : "false"); }
+
+  // "k": (keys are identifiers, no escaping)
+  void key(const char* k) {
+    ch('"');
+    raw(k);
+    raw("\":", 2);
+  }
+
+  // Quoted string without escaping, for fixed tokens only
+  void str(const char* s) {
+    ch('"');
+    raw(s);
+    ch('"');
+  }
+};
\ No newline at end of file
@@ -0,0 +1,287 @@
+// Generated by tools/gzip_page.py from _PAGE_INDEX in web.h - do not edit
+#pragma once
+#include <Arduino.h>
+
+#define PAGE_INDEX_SRC_LEN   18663UL
+#define PAGE_INDEX_SRC_HASH  0x9D1AC982UL   // FNV-1a of the expanded page
+#define PAGE_INDEX_ETAG      "\"9d1ac982\""
+
+static const uint8_t _PAGE_INDEX_GZ[4430] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x5c, 0xeb, 0x92, 0xdb, 0x36,
+  0xb2, 0xfe, 0x3f, 0x4f, 0x81, 0x68, 0x2b, 0x2b, 0x6a, 0x23, 0xea, 0x3a, 0x1a, 0x8f, 0x35, 0x1a,
+  0xe5, 0x6c, 0x7c, 0x39, 0xc9, 0x59, 0xdb, 0xe3, 0x1a, 0x4d, 0xf6, 0x52, 0x2e, 0x97, 0x0b, 0x22,
+  0x21, 0x89, 0x19, 0x8a, 0x60, 0x11, 0x90, 0x34, 0x93, 0xac, 0xdf, 0xe9, 0x9c, 0x57, 0xd8, 0x27,
+  0x3b, 0xdd, 0x00, 0x49, 0xf1, 0x02, 0x52, 0xd2, 0xc4, 0xc9, 0x56, 0xad, 0x2b, 0x63, 0x93, 0x04,
+  0xd0, 0xdd, 0xe8, 0x6e, 0x34, 0xbe, 0x6e, 0x60, 0x32, 0xf9, 0xea, 0xe5, 0xcd, 0x8b, 0xbb, 0x7f,
+  0xbc, 0x7f, 0x45, 0x56, 0x72, 0xed, 0x4f, 0xcf, 0x26, 0xf8, 0x0f, 0xf1, 0x69, 0xb0, 0xbc, 0x6e,
+  0xb0, 0xa0, 0x81, 0x1f, 0x18, 0x75, 0xa7, 0x67, 0x04, 0xfe, 0x4c, 0xd6, 0x4c, 0x52, 0xe2, 0xac,
+  0x68, 0x24, 0x98, 0xbc, 0x6e, 0xfc, 0x78, 0xf7, 0xda, 0xbe, 0x6c, 0x64, 0x9b, 0x02, 0xba, 0x66,
+  0xd7, 0x8d, 0xad, 0xc7, 0x76, 0x21, 0x8f, 0x64, 0x83, 0x38, 0x3c, 0x90, 0x2c, 0x80, 0xae, 0x3b,
+  0xcf, 0x95, 0xab, 0x6b, 0x97, 0x6d, 0x3d, 0x87, 0xd9, 0xea, 0xa5, 0x4d, 0xbc, 0xc0, 0x93, 0x1e,
+  0xf5, 0x6d, 0xe1, 0x50, 0x9f, 0x5d, 0xf7, 0x3b, 0xbd, 0x84, 0x94, 0xf4, 0xa4, 0xcf, 0xa6, 0xaf,
+  0x7d, 0xbe, 0x23, 0x33, 0x16, 0x08, 0x1e, 0x09, 0xf2, 0x92, 0x8a, 0xd5, 0x9c, 0xd3, 0xc8, 0x9d,
+  0x74, 0x75, 0xab, 0xee, 0x29, 0xe4, 0x63, 0xf2, 0x8c, 0x7f, 0xfe, 0x44, 0x7e, 0x49, 0x9f, 0xf1,
+  0xcf, 0x9a, 0x46, 0x4b, 0x2f, 0x18, 0x93, 0xde, 0x55, 0xee, 0x73, 0x48, 0x5d, 0xd7, 0x0b, 0x96,
+  0xa5, 0xef, 0x73, 0xfe, 0x60, 0x0b, 0xef, 0x67, 0xd5, 0x34, 0xe7, 0x91, 0xcb, 0x22, 0x1b, 0x3e,
+  0xed, 0xfb, 0x7c, 0x3e, 0x3b, 0xdb, 0x77, 0x75, 0x1f, 0x0b, 0xcc, 0x16, 0x30, 0x57, 0x7b, 0x41,
+  0xd7, 0x9e, 0xff, 0x38, 0x26, 0x36, 0x0d, 0x43, 0x9f, 0xd9, 0xe2, 0x51, 0x48, 0xb6, 0x6e, 0x93,
+  0xef, 0x7c, 0x2f, 0xb8, 0x7f, 0x4b, 0x9d, 0x99, 0x7a, 0x7f, 0x0d, 0x3d, 0xdb, 0xa4, 0x39, 0x63,
+  0x4b, 0xce, 0xc8, 0x8f, 0x3f, 0x34, 0xdb, 0xe4, 0x96, 0xcf, 0xb9, 0xe4, 0x6d, 0x72, 0xf3, 0xf0,
+  0xb8, 0x64, 0x41, 0x9b, 0xfc, 0x38, 0xdf, 0x04, 0x72, 0xd3, 0x26, 0x2f, 0x68, 0x20, 0x69, 0xc4,
+  0x7c, 0xbf, 0x4d, 0x04, 0x0d, 0x84, 0x2d, 0x58, 0xe4, 0x2d, 0x0a, 0x42, 0x53, 0xe7, 0x7e, 0x19,
+  0xf1, 0x4d, 0xe0, 0x8e, 0x09, 0x70, 0x61, 0x34, 0xb2, 0x97, 0x11, 0x75, 0x3d, 0x50, 0xbb, 0xd5,
+  0x1f, 0x8e, 0x5c, 0xb6, 0x6c, 0x93, 0x3f, 0x0c, 0xd9, 0xe0, 0xd9, 0x60, 0x48, 0x7a, 0x5f, 0xc3,
+  0xf3, 0x39, 0x1b, 0x9e, 0x0f, 0x18, 0x19, 0xa9, 0x97, 0x91, 0x7b, 0xde, 0x1b, 0x3e, 0x23, 0xfd,
+  0x5e, 0xef, 0xeb, 0x56, 0x9e, 0xee, 0xda, 0x0b, 0xec, 0x15, 0xf3, 0x96, 0x2b, 0x39, 0xc6, 0xe6,
+  0xed, 0xaa, 0x42, 0x87, 0x83, 0x5e, 0xf8, 0x90, 0x6f, 0x72, 0xb8, 0xcf, 0xa3, 0x31, 0xf9, 0xc3,
+  0x62, 0xb1, 0x30, 0xea, 0xae, 0x83, 0x5e, 0x41, 0x41, 0xd4, 0xa8, 0x64, 0xae, 0x07, 0xed, 0x1b,
+  0xc0, 0xf1, 0xbc, 0x57, 0xa2, 0x9b, 0x5a, 0x93, 0xd0, 0x8d, 0xe4, 0x46, 0xd2, 0xab, 0x7e, 0x81,
+  0xa4, 0x64, 0x0f, 0xd2, 0xa6, 0xbe, 0xb7, 0x84, 0x71, 0x0e, 0xa8, 0x84, 0x45, 0x57, 0x65, 0xa3,
+  0x81, 0xcd, 0x19, 0x4c, 0xa4, 0x33, 0x8a, 0xd8, 0xda, 0xc4, 0x12, 0xbc, 0x40, 0x4a, 0xbe, 0x1e,
+  0x93, 0x61, 0x49, 0x26, 0x45, 0x5f, 0xac, 0xa8, 0xcb, 0x77, 0x40, 0x21, 0x7c, 0x50, 0x3f, 0xe7,
+  0xf0, 0x13, 0x2d, 0xe7, 0xd4, 0xea, 0xb5, 0x49, 0xfc, 0x5f, 0x67, 0x58, 0x50, 0xaf, 0xcf, 0x24,
+  0x08, 0x63, 0x8b, 0x90, 0x3a, 0x4a, 0x8d, 0xfd, 0xd0, 0xec, 0x68, 0x1d, 0xa1, 0x57, 0x00, 0x18,
+  0xd5, 0x73, 0x0b, 0x93, 0x73, 0x3d, 0x11, 0xfa, 0x14, 0xbc, 0x0d, 0xdb, 0xf2, 0xe4, 0xf1, 0x8b,
+  0x0d, 0xae, 0x06, 0xed, 0x92, 0xd9, 0x60, 0x91, 0xcd, 0x3a, 0x10, 0x63, 0x12, 0xb1, 0x90, 0x51,
+  0x69, 0xa1, 0xfe, 0xec, 0x85, 0x07, 0x4e, 0x08, 0x56, 0x06, 0xad, 0x5b, 0x43, 0xb4, 0x62, 0x9b,
+  0xf4, 0x17, 0x51, 0xab, 0x20, 0xe7, 0x92, 0x86, 0x26, 0x1b, 0xd7, 0x2a, 0xa6, 0x2c, 0xbe, 0xed,
+  0xc0, 0xd2, 0x2d, 0x48, 0x9f, 0x75, 0x5c, 0xa5, 0xad, 0xfe, 0xa0, 0xdf, 0x26, 0x97, 0xa3, 0x36,
+  0x79, 0x36, 0x40, 0x8d, 0x0d, 0x46, 0xad, 0xb2, 0xa7, 0xbb, 0x11, 0x0f, 0x41, 0x72, 0x1f, 0x74,
+  0x07, 0x6b, 0xd4, 0xdf, 0x44, 0x30, 0x2a, 0x7c, 0x28, 0x76, 0x54, 0x6b, 0x57, 0xe9, 0x94, 0x08,
+  0xee, 0x83, 0xde, 0x14, 0xfd, 0xc1, 0x08, 0x68, 0xef, 0xff, 0xea, 0x75, 0xfa, 0x97, 0xc6, 0x81,
+  0x36, 0x2e, 0x9f, 0x0d, 0x68, 0xab, 0x7f, 0x51, 0x9c, 0x76, 0x8d, 0xd7, 0xab, 0xe0, 0x11, 0x3b,
+  0x42, 0x8f, 0x5c, 0x02, 0xeb, 0xe1, 0xe0, 0x08, 0x3f, 0x90, 0x11, 0xac, 0x6b, 0x88, 0x83, 0x1c,
+  0x1c, 0x54, 0x3d, 0x2f, 0x78, 0xb4, 0xc6, 0x7e, 0x82, 0x30, 0x2a, 0x58, 0x3b, 0x43, 0x77, 0xff,
+  0xf5, 0xa0, 0xaa, 0xc7, 0x2b, 0xbe, 0x2d, 0x2d, 0xaf, 0x94, 0x7c, 0xcc, 0x09, 0x5d, 0xe3, 0x1f,
+  0x96, 0x3d, 0x32, 0xe8, 0x2f, 0x3b, 0x95, 0xbe, 0x72, 0xe9, 0x9e, 0x61, 0x2e, 0xe7, 0xad, 0x5a,
+  0x41, 0x70, 0xdf, 0x28, 0x09, 0x91, 0xfa, 0xec, 0xc2, 0x67, 0x05, 0x0d, 0xfe, 0xb4, 0x11, 0xd2,
+  0x5b, 0x3c, 0xda, 0xf1, 0xa6, 0x31, 0x26, 0xb8, 0x38, 0x98, 0x3d, 0x67, 0x72, 0xc7, 0x58, 0x90,
+  0xef, 0xab, 0x96, 0xb4, 0xed, 0x81, 0x87, 0x0b, 0xf3, 0xc2, 0x2e, 0x38, 0x68, 0x7f, 0x54, 0x61,
+  0xca, 0x9a, 0x1e, 0xe9, 0x16, 0x10, 0x77, 0x38, 0xe0, 0x4d, 0x83, 0x7a, 0x6d, 0xa8, 0x6d, 0xcb,
+  0xb4, 0x65, 0xe8, 0xe8, 0xd3, 0xef, 0x0c, 0x4a, 0xd1, 0x47, 0x35, 0xef, 0xe2, 0x18, 0x7c, 0xd1,
+  0xeb, 0x55, 0x85, 0x59, 0xc7, 0x99, 0x3b, 0xb5, 0xbc, 0xbd, 0x60, 0xc1, 0x8f, 0xb7, 0x83, 0x5a,
+  0xf2, 0x65, 0x75, 0x64, 0x84, 0xed, 0x75, 0x9e, 0x1f, 0x0a, 0x95, 0x86, 0xf1, 0xc0, 0xc8, 0xde,
+  0x45, 0x48, 0x1c, 0xff, 0x36, 0x0b, 0x8c, 0x92, 0xda, 0x73, 0xea, 0x2e, 0xd9, 0xa1, 0x68, 0xa1,
+  0x55, 0xdf, 0x3b, 0x87, 0xa8, 0x75, 0x79, 0x59, 0xd4, 0x7f, 0x6e, 0xad, 0x82, 0x24, 0xca, 0x89,
+  0x6b, 0xd7, 0xba, 0x69, 0x41, 0xd7, 0x44, 0x91, 0x0c, 0xdf, 0x61, 0x95, 0xdd, 0x25, 0x95, 0x1b,
+  0x61, 0xf3, 0xfb, 0xc2, 0x4c, 0x12, 0xbb, 0x5d, 0xf6, 0x9d, 0x67, 0x97, 0xe7, 0xb5, 0x63, 0x59,
+  0x14, 0xf1, 0xa8, 0x62, 0x38, 0x5b, 0x8c, 0x86, 0xa3, 0x9e, 0x79, 0x38, 0x60, 0xb1, 0xc8, 0x73,
+  0x84, 0x11, 0x0d, 0xa5, 0x16, 0x1a, 0x54, 0xc6, 0x6c, 0x3d, 0xdc, 0x8e, 0x20, 0xe4, 0x3c, 0xdd,
+  0x5f, 0xe7, 0xdc, 0x77, 0xcd, 0xfb, 0x77, 0x1f, 0x63, 0xc9, 0x13, 0x9c, 0x39, 0x16, 0xcb, 0xa7,
+  0x73, 0xe6, 0x57, 0x0b, 0x66, 0xf2, 0xcd, 0x84, 0xfa, 0xdc, 0xa1, 0x94, 0x9e, 0xd7, 0x08, 0x1d,
+  0x40, 0x74, 0xa4, 0xbe, 0x99, 0xbd, 0x4b, 0x25, 0xb5, 0x25, 0x9d, 0x97, 0x56, 0x71, 0x02, 0x59,
+  0x00, 0x43, 0x19, 0x5d, 0x0c, 0xb8, 0xfb, 0x34, 0x14, 0x20, 0x5b, 0xf2, 0x54, 0xb3, 0xb0, 0x2e,
+  0x2b, 0x41, 0x88, 0xe4, 0xa5, 0x65, 0x59, 0x21, 0x9e, 0x5c, 0x9d, 0xbc, 0x78, 0xfa, 0xa3, 0xaa,
+  0xd5, 0x73, 0x69, 0x84, 0x3c, 0x31, 0xa4, 0xf2, 0xd9, 0x42, 0x7e, 0x89, 0x98, 0x65, 0x08, 0xb7,
+  0x83, 0x27, 0x86, 0xdb, 0xac, 0x1e, 0x8a, 0x90, 0x23, 0x9d, 0x14, 0x6c, 0xec, 0xe5, 0x89, 0x9d,
+  0x18, 0xef, 0xfb, 0x47, 0x08, 0x10, 0x19, 0x37, 0xe2, 0x0a, 0x73, 0x64, 0x68, 0xf7, 0x46, 0x15,
+  0xc4, 0x65, 0xc4, 0x82, 0x4a, 0x18, 0x38, 0xf7, 0xb9, 0x73, 0x7f, 0x75, 0x9c, 0x6f, 0xae, 0x52,
+  0x13, 0x55, 0x40, 0xbb, 0x03, 0xee, 0x86, 0x9b, 0x74, 0xc4, 0x7d, 0xf1, 0x1f, 0x05, 0xea, 0x46,
+  0x5f, 0x00, 0xd4, 0x99, 0x94, 0x64, 0x86, 0x42, 0xb9, 0x68, 0x3a, 0x3c, 0x71, 0xf7, 0xaf, 0x0d,
+  0xe6, 0x87, 0x96, 0x5a, 0x5d, 0x56, 0x64, 0x90, 0xdf, 0x9e, 0x6f, 0x80, 0x4b, 0x20, 0x7e, 0x35,
+  0x84, 0x28, 0x21, 0x3c, 0x63, 0x4a, 0x56, 0x85, 0x13, 0x4e, 0xda, 0xc3, 0xe6, 0x32, 0xa8, 0x5a,
+  0xfc, 0x0a, 0xd0, 0x0e, 0x2e, 0xab, 0xf6, 0xfb, 0x80, 0x07, 0xac, 0xde, 0x83, 0x06, 0x35, 0xd0,
+  0xa8, 0x7f, 0x2a, 0x8a, 0xdb, 0x44, 0x02, 0xed, 0x14, 0x72, 0xaf, 0xac, 0x8a, 0x6c, 0x72, 0x40,
+  0x7d, 0xdf, 0x94, 0x00, 0x94, 0xbd, 0xf4, 0x3c, 0x86, 0x3b, 0x25, 0x2f, 0x2d, 0x02, 0x24, 0xe5,
+  0x05, 0x99, 0xa4, 0x60, 0x13, 0x86, 0x2c, 0x72, 0x4a, 0xd4, 0x8b, 0x99, 0x6a, 0xaf, 0x33, 0x32,
+  0x6e, 0x09, 0x2e, 0x73, 0x78, 0x44, 0xb5, 0xb0, 0x65, 0x1d, 0xa6, 0xce, 0xe2, 0x05, 0x58, 0xa5,
+  0xb0, 0x0b, 0xb1, 0xaa, 0x60, 0xba, 0x31, 0x74, 0xc7, 0x08, 0x5a, 0x0c, 0x75, 0x1c, 0x85, 0x90,
+  0x8f, 0x4a, 0x08, 0xb3, 0x1e, 0x03, 0x8e, 0x9e, 0xed, 0xf3, 0x1d, 0x73, 0x2b, 0xa9, 0xdb, 0x00,
+  0xaf, 0x22, 0x59, 0x13, 0xb9, 0x2a, 0xeb, 0x28, 0x17, 0x17, 0xf3, 0xf9, 0x05, 0xc5, 0x22, 0x8a,
+  0x43, 0x17, 0xa3, 0x5e, 0xcb, 0xb8, 0xe4, 0x76, 0x2b, 0xc8, 0x4b, 0x0e, 0x30, 0xd7, 0xfb, 0xc2,
+  0x18, 0xa4, 0xb5, 0xd2, 0xb9, 0xb6, 0x9e, 0x22, 0x91, 0x16, 0x04, 0x4b, 0x3c, 0x97, 0x97, 0x6c,
+  0xe8, 0x98, 0xb2, 0xcb, 0x72, 0xca, 0x37, 0x38, 0x90, 0xf2, 0xe1, 0xf6, 0x88, 0x71, 0x52, 0xbb,
+  0xd0, 0xb3, 0x0b, 0x80, 0x09, 0xcf, 0x20, 0xb8, 0x5e, 0xd6, 0x66, 0x7d, 0x7a, 0x6e, 0x3c, 0x7c,
+  0xca, 0x2c, 0x34, 0x98, 0xc5, 0x87, 0xd1, 0xf0, 0xf9, 0x70, 0xf4, 0x44, 0xbd, 0xc2, 0x8e, 0xf5,
+  0xa5, 0xd4, 0xaa, 0xe5, 0x80, 0x07, 0xe7, 0x62, 0x70, 0x39, 0xb8, 0xfc, 0x2d, 0xd4, 0x3a, 0x18,
+  0x3e, 0x07, 0x95, 0x0e, 0x8f, 0x51, 0x2b, 0x8c, 0x0f, 0x7c, 0x4e, 0xdd, 0x27, 0x39, 0xc8, 0x80,
+  0x8e, 0x16, 0x38, 0x93, 0x41, 0xff, 0xf9, 0xc5, 0x62, 0xf8, 0x24, 0xd5, 0x26, 0xfc, 0x0f, 0xa2,
+  0x99, 0x4a, 0x29, 0x34, 0x73, 0x78, 0xe8, 0x3f, 0x7f, 0x76, 0xe1, 0x0e, 0x7e, 0x0b, 0x7d, 0x5e,
+  0xa0, 0x9b, 0x5e, 0x20, 0x10, 0x38, 0x1f, 0xd5, 0x29, 0x34, 0xd9, 0xd4, 0x4e, 0x4b, 0x8a, 0x2b,
+  0x8a, 0x13, 0x54, 0x4d, 0xfc, 0x94, 0x92, 0x99, 0xc2, 0x55, 0xe5, 0xd6, 0xe3, 0xb3, 0x63, 0x2c,
+  0x7a, 0x9c, 0x58, 0xe5, 0xdc, 0x6f, 0x7d, 0x98, 0x7a, 0x19, 0x2a, 0x1d, 0x07, 0x01, 0x69, 0xff,
+  0x00, 0xa8, 0x32, 0xce, 0x07, 0xbe, 0x97, 0x6b, 0xca, 0x09, 0x22, 0x1d, 0x55, 0x6e, 0xdd, 0x6a,
+  0x96, 0x07, 0xb3, 0x3c, 0x43, 0xa2, 0x54, 0x97, 0xe6, 0x15, 0x80, 0xc3, 0xa8, 0x96, 0xf9, 0x96,
+  0xfa, 0x9b, 0xda, 0x5a, 0x4d, 0xff, 0xcb, 0xd7, 0x6a, 0x04, 0xf3, 0x99, 0x23, 0xab, 0xf9, 0x67,
+  0x6d, 0xa4, 0x16, 0x49, 0x48, 0x21, 0x17, 0x90, 0xc7, 0x60, 0x98, 0x5a, 0x2e, 0x3c, 0xc4, 0x2d,
+  0xbb, 0x86, 0x59, 0x7c, 0x46, 0x60, 0x56, 0xd7, 0x82, 0x73, 0x59, 0x2e, 0x34, 0x1e, 0x70, 0xc7,
+  0xec, 0x4a, 0x28, 0x97, 0xd4, 0x8f, 0x38, 0x59, 0xa8, 0xcc, 0xe3, 0xcd, 0x25, 0x80, 0x8c, 0xc0,
+  0xff, 0xb5, 0x66, 0xae, 0x47, 0x89, 0x95, 0x39, 0x6a, 0x78, 0x76, 0x01, 0x50, 0xb0, 0xb8, 0x49,
+  0x94, 0x0e, 0x12, 0x4a, 0x2e, 0x70, 0x59, 0x72, 0x81, 0xcf, 0xb9, 0xb7, 0xdc, 0x4b, 0x5d, 0x15,
+  0xbf, 0xa6, 0x5c, 0xdf, 0x5f, 0x44, 0xc7, 0xb3, 0xa8, 0x07, 0xeb, 0x69, 0x8c, 0x71, 0xbd, 0x08,
+  0x3c, 0x40, 0xa1, 0x34, 0xcd, 0xe7, 0x78, 0x0e, 0x65, 0x4c, 0x5d, 0x9b, 0x62, 0x7e, 0x3e, 0xcb,
+  0x3f, 0x4d, 0xba, 0xf1, 0x71, 0xdd, 0xa4, 0xab, 0x8f, 0x14, 0x27, 0x78, 0x8a, 0x16, 0x9f, 0xe4,
+  0xb9, 0xde, 0x96, 0x38, 0x3e, 0x15, 0xe2, 0xba, 0x91, 0x1e, 0x0f, 0x35, 0xf6, 0x27, 0x7b, 0x93,
+  0x55, 0xbf, 0xf2, 0x40, 0x10, 0x9a, 0xce, 0x4a, 0x02, 0x4f, 0xbe, 0xb2, 0x6d, 0x72, 0x13, 0x30,
+  0xa2, 0x4e, 0x1e, 0x00, 0xd8, 0x12, 0x6d, 0x82, 0x36, 0x99, 0x6f, 0x20, 0xd3, 0x24, 0x8b, 0x88,
+  0xaf, 0x89, 0x5c, 0x31, 0xb2, 0xf0, 0x22, 0x21, 0x49, 0x97, 0x86, 0x1e, 0x89, 0x98, 0x08, 0x41,
+  0x73, 0x8c, 0xd8, 0x76, 0x86, 0x73, 0x46, 0xb2, 0xac, 0x15, 0x1b, 0xc4, 0x73, 0xd3, 0x2f, 0xff,
+  0x8d, 0x1f, 0xa6, 0x93, 0x2e, 0xf4, 0x9d, 0x9e, 0x19, 0x87, 0x26, 0xa9, 0x60, 0x66, 0x4e, 0x7a,
+  0x5e, 0x83, 0x62, 0x8f, 0x38, 0x59, 0x6c, 0x4c, 0x5f, 0xdc, 0xbc, 0xbb, 0xbb, 0xbd, 0x79, 0x33,
+  0x83, 0x19, 0x0e, 0x0a, 0xa3, 0xca, 0x84, 0x13, 0xb3, 0x17, 0xe8, 0xab, 0xde, 0xba, 0x29, 0x19,
+  0x80, 0x56, 0x4c, 0x71, 0xa8, 0x9e, 0x05, 0xbc, 0xce, 0xf4, 0x1b, 0x0f, 0x1c, 0xdf, 0x73, 0xee,
+  0x61, 0x62, 0xf8, 0xfe, 0x96, 0x07, 0x9e, 0xe4, 0x11, 0xac, 0x46, 0xab, 0xd5, 0x98, 0xaa, 0x2e,
+  0x93, 0xae, 0xa6, 0x76, 0x02, 0x1b, 0x1e, 0x66, 0xb8, 0xe0, 0x4b, 0x86, 0x09, 0x0f, 0x73, 0x3c,
+  0x48, 0x02, 0xda, 0xa6, 0xd8, 0xb3, 0x86, 0x17, 0x2d, 0xb2, 0x49, 0x20, 0x4a, 0xca, 0xea, 0x65,
+  0xfa, 0x61, 0x15, 0xb1, 0xc5, 0x75, 0xa3, 0xeb, 0xf3, 0x65, 0xc7, 0x11, 0xdb, 0x06, 0x51, 0x5e,
+  0x78, 0xdd, 0x48, 0x36, 0x7b, 0x15, 0x2b, 0x1b, 0xd3, 0xa4, 0x3f, 0x79, 0x31, 0xfb, 0xeb, 0xa4,
+  0x4b, 0x0d, 0x3c, 0xf5, 0x96, 0x14, 0xf3, 0xdd, 0x6f, 0x52, 0x29, 0x41, 0x7d, 0x26, 0x01, 0x11,
+  0x76, 0x31, 0x8e, 0xa3, 0x1e, 0xb8, 0x84, 0x17, 0x84, 0x1b, 0x49, 0xe4, 0x63, 0x08, 0x1d, 0x9c,
+  0x15, 0x73, 0xee, 0x01, 0xc2, 0x68, 0x19, 0x17, 0x1b, 0xdf, 0xbf, 0x85, 0xe5, 0xde, 0x98, 0x92,
+  0xd7, 0xf0, 0x48, 0x20, 0x77, 0x62, 0xc4, 0x1a, 0xf4, 0xc8, 0xf7, 0x3f, 0xb7, 0x26, 0x5d, 0x45,
+  0xba, 0x60, 0x75, 0xed, 0x5e, 0x87, 0x1c, 0x01, 0x25, 0x33, 0x79, 0x41, 0xa6, 0x6b, 0x8a, 0x23,
+  0x0c, 0xfd, 0x8c, 0x7d, 0xf5, 0x44, 0xa7, 0x3f, 0x86, 0x2e, 0x08, 0x29, 0x0c, 0x82, 0x54, 0x8e,
+  0x54, 0x9b, 0x8c, 0x9e, 0x30, 0x9e, 0x3a, 0x86, 0xdc, 0x07, 0x3a, 0xf8, 0x77, 0x05, 0x91, 0xaa,
+  0xcf, 0x5f, 0x40, 0xfa, 0x37, 0x14, 0x16, 0xfa, 0x46, 0x4d, 0xe1, 0x89, 0x33, 0x80, 0xaf, 0x52,
+  0x13, 0x68, 0x4c, 0x6d, 0xfb, 0xf7, 0x9f, 0xc1, 0x0f, 0xe8, 0x55, 0x20, 0xcf, 0x13, 0xc5, 0xf7,
+  0xe2, 0xe1, 0x8d, 0x29, 0x04, 0xeb, 0x1e, 0x59, 0x8b, 0xdf, 0x7f, 0x06, 0xb7, 0x58, 0x24, 0xc0,
+  0xed, 0xfd, 0x89, 0x53, 0x80, 0xbd, 0x0b, 0xcf, 0x46, 0xc4, 0xbf, 0x47, 0xff, 0x77, 0x58, 0x7d,
+  0xad, 0x93, 0x5c, 0xc3, 0xab, 0x2a, 0xe1, 0x55, 0xf1, 0xf6, 0xce, 0x83, 0xd8, 0x8e, 0x21, 0x70,
+  0x45, 0x83, 0x25, 0xcb, 0x7c, 0x24, 0xd7, 0xe4, 0x1b, 0xb9, 0xf2, 0x44, 0x47, 0x8d, 0xb8, 0x22,
+  0x18, 0x8c, 0x14, 0x43, 0x8c, 0xbd, 0x46, 0x76, 0x8a, 0x65, 0x8c, 0xdf, 0xd4, 0xa0, 0xeb, 0x46,
+  0x0f, 0x6c, 0x8b, 0x30, 0x7b, 0xd2, 0xd5, 0xdf, 0x8f, 0x1e, 0xd8, 0x47, 0xa7, 0x78, 0xd2, 0xc8,
+  0x01, 0xb2, 0x5c, 0x9d, 0x3c, 0x6c, 0xa8, 0x18, 0x1e, 0x18, 0x07, 0x90, 0x41, 0x69, 0xf4, 0x28,
+  0x2b, 0x17, 0x3e, 0xd5, 0xed, 0xc6, 0x1a, 0xb6, 0x16, 0xd4, 0x3a, 0x83, 0xc5, 0xc1, 0x5c, 0x32,
+  0x7f, 0x24, 0xaf, 0x66, 0xef, 0x2f, 0x07, 0x17, 0x17, 0x67, 0x06, 0xca, 0x59, 0xaa, 0x13, 0xe1,
+  0x44, 0x5e, 0x98, 0x11, 0x0e, 0x42, 0x30, 0x84, 0x98, 0xb7, 0x7f, 0xfe, 0xfb, 0xa7, 0xdb, 0x9b,
+  0xbf, 0xcd, 0xc0, 0xa0, 0xfd, 0x4c, 0x1e, 0xe0, 0x33, 0x19, 0x63, 0x90, 0x97, 0x54, 0x52, 0x68,
+  0xfc, 0xf0, 0x31, 0xdf, 0xa8, 0x23, 0x4b, 0xb2, 0xc6, 0x0b, 0x03, 0xc1, 0x4d, 0xe8, 0x3a, 0xff,
+  0x2d, 0x3e, 0xe5, 0xbb, 0x83, 0xad, 0x14, 0xa8, 0x15, 0x38, 0x65, 0xdd, 0xaa, 0xd0, 0x84, 0xe0,
+  0x7e, 0xe1, 0xf9, 0x58, 0x5d, 0xbb, 0x26, 0x0b, 0xea, 0x63, 0xc1, 0x2f, 0xed, 0xb0, 0xd8, 0x04,
+  0x0a, 0x1d, 0x92, 0x12, 0x00, 0x28, 0x9d, 0x43, 0xe2, 0x5c, 0xd7, 0xdc, 0x65, 0x40, 0xc5, 0xe5,
+  0xce, 0x66, 0x0d, 0x7b, 0x5e, 0x67, 0xc9, 0xe4, 0x2b, 0x9f, 0xe1, 0xe3, 0x77, 0x8f, 0x3f, 0xb8,
+  0x56, 0x33, 0xd9, 0xe4, 0x9a, 0xad, 0x8e, 0xda, 0xfd, 0x80, 0xe7, 0xb7, 0xa4, 0x19, 0xd1, 0x5d,
+  0x93, 0x8c, 0x49, 0x93, 0x6e, 0x97, 0xcd, 0x02, 0x8a, 0x67, 0xd2, 0x59, 0x59, 0xcd, 0xae, 0xe2,
+  0xfe, 0x2d, 0x52, 0xbf, 0x6e, 0x92, 0x6f, 0x14, 0x9b, 0x36, 0xf9, 0x05, 0xa7, 0xbc, 0xe2, 0x90,
+  0x93, 0x34, 0xdf, 0xdf, 0xcc, 0xee, 0x9a, 0xe4, 0x73, 0xab, 0xe4, 0x17, 0x1d, 0xc0, 0x74, 0x81,
+  0x05, 0xd2, 0x5e, 0x4f, 0x0d, 0x58, 0x55, 0x25, 0xf9, 0x55, 0xb2, 0x26, 0x28, 0x08, 0x64, 0x4d,
+  0xcb, 0x8f, 0xd7, 0xa0, 0xc8, 0x4d, 0xa1, 0x94, 0x79, 0x1c, 0x21, 0x1e, 0xe6, 0xe9, 0xc4, 0x8a,
+  0x3e, 0x95, 0x50, 0x02, 0x4b, 0x80, 0x98, 0x82, 0x19, 0x9d, 0x18, 0xb6, 0x00, 0xc5, 0x26, 0x22,
+  0x97, 0xa6, 0x99, 0xa4, 0xf6, 0x25, 0x74, 0x34, 0xab, 0x55, 0xee, 0x61, 0xd2, 0x9b, 0x43, 0x51,
+  0xf3, 0x0c, 0xf5, 0x86, 0xa6, 0xe5, 0xc0, 0x4a, 0x1d, 0x3f, 0x5b, 0x4d, 0xa5, 0x14, 0xa2, 0x5e,
+  0xc6, 0xcd, 0x36, 0x61, 0x2d, 0x73, 0x61, 0x25, 0xe3, 0x39, 0x79, 0x54, 0x57, 0x4c, 0xa4, 0x53,
+  0x13, 0x83, 0x8a, 0xfe, 0x4d, 0x46, 0x7d, 0xa2, 0x31, 0xca, 0x56, 0xad, 0xf6, 0x8e, 0x9c, 0x05,
+  0x48, 0xb7, 0x0b, 0x21, 0x9f, 0x11, 0x04, 0x10, 0x90, 0x66, 0x2c, 0x20, 0xd3, 0x58, 0x11, 0xc9,
+  0xe1, 0x71, 0xcb, 0xa8, 0x8f, 0x90, 0x93, 0x68, 0xa8, 0xfb, 0xab, 0x4d, 0xc5, 0xc3, 0x13, 0x2c,
+  0xe5, 0x40, 0x50, 0x91, 0xec, 0x05, 0x64, 0x48, 0x96, 0x67, 0x5e, 0xdf, 0x2a, 0x7b, 0xca, 0xac,
+  0x6f, 0x3d, 0x22, 0xd6, 0x8b, 0xd5, 0x84, 0x58, 0xd8, 0x2c, 0x56, 0x14, 0x61, 0x44, 0x47, 0x85,
+  0xd9, 0x77, 0x74, 0x8d, 0xb1, 0xa1, 0x99, 0xb9, 0x97, 0xd4, 0x34, 0xf4, 0xf5, 0xdc, 0x7d, 0x27,
+  0x5c, 0xeb, 0x9e, 0xa9, 0x4f, 0x00, 0xe9, 0xe0, 0xf7, 0x77, 0x6f, 0xdf, 0x90, 0xeb, 0x92, 0x3a,
+  0x9a, 0xe5, 0x0c, 0x2d, 0x4d, 0xa1, 0x26, 0x22, 0xa4, 0x41, 0xa1, 0x4d, 0x5d, 0xc4, 0x81, 0x6c,
+  0xe6, 0xd5, 0xbb, 0xd9, 0xcd, 0x2d, 0x51, 0x1c, 0xe1, 0xa7, 0x09, 0x5b, 0x0d, 0xf4, 0x8d, 0x73,
+  0x38, 0xf8, 0x7a, 0x14, 0x1f, 0x8d, 0xb5, 0x4d, 0xbd, 0xf5, 0x88, 0x2c, 0xfb, 0xfd, 0xd5, 0x16,
+  0x00, 0x12, 0x90, 0xea, 0x8f, 0x89, 0x6e, 0x56, 0xc8, 0x00, 0xde, 0x53, 0x49, 0x34, 0xb6, 0x51,
+  0xd2, 0x90, 0x7f, 0xfd, 0xef, 0x8b, 0xf8, 0xf1, 0x74, 0x26, 0x33, 0x75, 0x89, 0x24, 0x61, 0x93,
+  0x08, 0x9e, 0xdc, 0x4a, 0x89, 0xf3, 0x57, 0xf5, 0x9a, 0x61, 0x7d, 0xf3, 0x97, 0x54, 0x11, 0x95,
+  0x6c, 0x9b, 0x47, 0x2a, 0x29, 0xde, 0xa0, 0xea, 0x14, 0x54, 0xea, 0x8d, 0xb7, 0x4e, 0x0a, 0x76,
+  0xcb, 0xde, 0xfb, 0x68, 0x4c, 0xdf, 0x32, 0x1a, 0x58, 0xeb, 0x37, 0x5d, 0x80, 0x2a, 0xad, 0x31,
+  0x49, 0x84, 0x4d, 0x35, 0xb9, 0x86, 0x66, 0x93, 0x26, 0xab, 0x45, 0x7e, 0xaa, 0x20, 0xb7, 0x6f,
+  0x67, 0x35, 0x72, 0x44, 0x6b, 0xf1, 0xfb, 0x88, 0xf1, 0x7e, 0xe3, 0x8b, 0xf8, 0xd4, 0xad, 0x24,
+  0x44, 0x08, 0x6d, 0xec, 0xf7, 0x11, 0xe3, 0x8e, 0x4b, 0xea, 0x83, 0x3e, 0x4c, 0xba, 0x90, 0xd8,
+  0x76, 0x9a, 0x18, 0xb5, 0x2e, 0xe6, 0xd0, 0x60, 0x4b, 0x45, 0x22, 0x87, 0x42, 0x3a, 0x19, 0x80,
+  0xbd, 0x67, 0xa4, 0x4b, 0x53, 0x00, 0x35, 0x7b, 0xbd, 0x46, 0x7c, 0xe1, 0xe1, 0xba, 0x71, 0xd1,
+  0xc3, 0x42, 0x8d, 0x26, 0x51, 0x41, 0x5f, 0x5f, 0xde, 0x88, 0xc9, 0xef, 0xaf, 0x73, 0xc0, 0x38,
+  0xa9, 0x0a, 0x57, 0x13, 0x19, 0xe1, 0xe3, 0xf4, 0xdd, 0x66, 0x3d, 0x67, 0xd1, 0xa4, 0x0b, 0x8f,
+  0xf8, 0xaa, 0xea, 0x53, 0x89, 0x4b, 0xa4, 0x5f, 0x71, 0xa9, 0x13, 0x0b, 0xd6, 0x71, 0xfc, 0xa9,
+  0x8b, 0x83, 0xbb, 0x9a, 0x50, 0x05, 0x7b, 0x75, 0xb9, 0x1c, 0xe7, 0x83, 0xbc, 0x33, 0x7a, 0x83,
+  0x61, 0xaa, 0x62, 0x06, 0xff, 0xa2, 0x3c, 0xd3, 0x42, 0x34, 0xad, 0xdc, 0xb9, 0x32, 0x45, 0x2a,
+  0xd8, 0xbd, 0x68, 0x18, 0x82, 0x96, 0x5e, 0xac, 0x3c, 0xdf, 0xb5, 0x30, 0xb8, 0x16, 0xe2, 0xf7,
+  0x1e, 0xa2, 0x76, 0xc2, 0x8d, 0x58, 0x59, 0x1f, 0x3e, 0x1e, 0xd8, 0x44, 0x50, 0xe7, 0x2c, 0xba,
+  0xe5, 0x3b, 0x51, 0xb5, 0x89, 0xe8, 0x09, 0xd5, 0xa0, 0xc4, 0x74, 0x9e, 0xc5, 0x73, 0x21, 0x1c,
+  0x98, 0x0d, 0xfe, 0x19, 0xe9, 0x3e, 0x78, 0x76, 0xff, 0x63, 0x67, 0x4d, 0x43, 0xcb, 0x02, 0xdf,
+  0x6c, 0x83, 0xbe, 0x1e, 0x14, 0x3e, 0x30, 0x29, 0x14, 0xcd, 0xa5, 0xb4, 0x4d, 0x2c, 0xe8, 0x06,
+  0xff, 0xf4, 0x5b, 0x3a, 0xe4, 0x4b, 0x37, 0x6d, 0x29, 0x8d, 0x03, 0xaa, 0x9d, 0x05, 0x98, 0xb4,
+  0x23, 0xf9, 0x6b, 0xef, 0x81, 0xb9, 0xd6, 0xe0, 0xc8, 0x41, 0x18, 0xcc, 0x8d, 0x83, 0xd0, 0xf4,
+  0xcd, 0xdc, 0x90, 0x56, 0xe7, 0x27, 0xee, 0x05, 0x56, 0xb3, 0x79, 0x94, 0x8e, 0x2d, 0xd4, 0x53,
+  0x51, 0xc5, 0x95, 0x4a, 0xdd, 0x17, 0x2b, 0xc0, 0xe8, 0x58, 0x92, 0x7f, 0xa1, 0x8f, 0xae, 0x40,
+  0x8b, 0x01, 0xdb, 0x11, 0xd0, 0x21, 0xb3, 0xa0, 0x81, 0xbf, 0xe1, 0xf8, 0xfb, 0x17, 0x77, 0xde,
+  0x9a, 0xcd, 0xa4, 0x06, 0x6c, 0x57, 0xd5, 0x35, 0x60, 0xc0, 0x31, 0xba, 0x08, 0x44, 0xd2, 0x33,
+  0xc9, 0xb8, 0xec, 0xb7, 0xf5, 0x84, 0x37, 0xf7, 0x7c, 0x4f, 0x3e, 0x1a, 0x3c, 0xc0, 0xf5, 0xbf,
+  0x93, 0x41, 0x9d, 0x07, 0xe4, 0x90, 0x6e, 0x9e, 0xbf, 0xb7, 0x20, 0x6a, 0xe2, 0x9d, 0x68, 0x13,
+  0x90, 0x3f, 0xfe, 0x91, 0x24, 0xcf, 0x58, 0xcc, 0xfb, 0x04, 0x70, 0xc4, 0x7d, 0x6c, 0x19, 0x40,
+  0xa1, 0xe2, 0x58, 0x86, 0xcc, 0xd9, 0xdb, 0x07, 0x85, 0xe5, 0xf3, 0x99, 0x30, 0x88, 0x96, 0xc7,
+  0x93, 0x32, 0xa0, 0xef, 0xcf, 0xc7, 0x09, 0x1e, 0x25, 0x45, 0x10, 0xa3, 0xe0, 0x55, 0x2a, 0x4a,
+  0x4a, 0x1f, 0x45, 0x6b, 0x9a, 0x51, 0x6c, 0xc2, 0x4b, 0x25, 0x68, 0xe0, 0x81, 0x6d, 0x85, 0x74,
+  0xd2, 0xcf, 0xbb, 0xc8, 0x93, 0xec, 0xd3, 0x3c, 0x14, 0xd8, 0x46, 0xbe, 0xeb, 0x8a, 0x42, 0x3b,
+  0x5e, 0xc9, 0x0a, 0x01, 0xe1, 0x62, 0x6b, 0xfc, 0x5c, 0x9a, 0x6b, 0x85, 0x63, 0xe0, 0x45, 0x95,
+  0x38, 0xe2, 0x10, 0x4b, 0xf4, 0x3b, 0x1d, 0xf1, 0xae, 0xd5, 0x26, 0xfa, 0x50, 0x47, 0xa1, 0x39,
+  0x91, 0xa9, 0xbb, 0x4b, 0x70, 0xbb, 0xc2, 0x31, 0x4e, 0x44, 0x2c, 0xcc, 0x52, 0x3d, 0x4c, 0x9f,
+  0xaf, 0x94, 0x44, 0x1f, 0x9a, 0x7a, 0x2f, 0xfd, 0x78, 0x45, 0xbc, 0x6f, 0xbe, 0x31, 0x29, 0x4d,
+  0x7b, 0x99, 0xe6, 0x8a, 0x6e, 0x96, 0x1b, 0x54, 0xea, 0x8d, 0x86, 0xf1, 0xc8, 0x34, 0x1b, 0xea,
+  0x7c, 0x16, 0x2c, 0xe5, 0xaa, 0x95, 0x47, 0xc4, 0x57, 0x67, 0x15, 0x8c, 0x8a, 0xa8, 0xd8, 0x1c,
+  0x70, 0x4d, 0x11, 0x2d, 0x23, 0xac, 0x42, 0x5e, 0xaf, 0xfc, 0x5a, 0x3a, 0x7b, 0x74, 0x66, 0x12,
+  0x06, 0x74, 0xae, 0x31, 0x5e, 0xa9, 0x25, 0x21, 0x5e, 0x58, 0xf7, 0x5a, 0xae, 0x0e, 0xbf, 0xc7,
+  0x24, 0xfc, 0xe6, 0x2f, 0x2a, 0x07, 0x7f, 0x75, 0x7b, 0x7b, 0x73, 0x6b, 0xc8, 0x22, 0x53, 0x12,
+  0x59, 0x2c, 0x9f, 0x23, 0x90, 0x42, 0x49, 0x45, 0x27, 0x7b, 0x65, 0xb9, 0x69, 0x16, 0x16, 0xb7,
+  0x42, 0x16, 0x41, 0xb7, 0x88, 0x1d, 0xef, 0xf6, 0x29, 0x34, 0x6e, 0x99, 0x27, 0x83, 0xed, 0x9f,
+  0xfa, 0x22, 0x13, 0x70, 0xcd, 0xcc, 0x6f, 0xb9, 0xef, 0xa3, 0x07, 0xa2, 0x6f, 0x10, 0xb5, 0x7f,
+  0x96, 0xa7, 0x5c, 0xd8, 0x5c, 0x36, 0x81, 0x58, 0x79, 0x0b, 0x69, 0x99, 0x53, 0x4e, 0xdc, 0x1b,
+  0xc6, 0x89, 0x14, 0xf8, 0x02, 0x52, 0xb4, 0x8d, 0x3d, 0xa5, 0x42, 0xfb, 0x79, 0x79, 0x0d, 0x89,
+  0x9e, 0xd9, 0x51, 0x8b, 0x42, 0x69, 0x4f, 0x05, 0xef, 0x4d, 0xca, 0x4c, 0xad, 0x8a, 0x94, 0xb8,
+  0x38, 0x30, 0xe4, 0xa1, 0xb1, 0x16, 0x50, 0xd6, 0x56, 0x6e, 0x47, 0xbf, 0x3a, 0xc1, 0x54, 0x29,
+  0xce, 0xab, 0xb2, 0x15, 0x76, 0xf8, 0xb4, 0xf6, 0x53, 0x63, 0xf5, 0x2b, 0x8c, 0x15, 0x87, 0x92,
+  0xe4, 0x1e, 0x3b, 0x64, 0xc9, 0xd1, 0x23, 0xe9, 0xf7, 0xe2, 0xa4, 0x5a, 0x18, 0x15, 0x95, 0x2b,
+  0x87, 0x5d, 0x5f, 0x93, 0x5e, 0xeb, 0xd4, 0x5a, 0x41, 0x9a, 0x3b, 0x54, 0x88, 0x8f, 0xed, 0xfd,
+  0x5e, 0xce, 0xd3, 0x4e, 0xa2, 0x9f, 0xe4, 0x04, 0x15, 0xe4, 0xa1, 0xf9, 0xd7, 0x50, 0xdf, 0x83,
+  0xfd, 0x0a, 0xfa, 0xaa, 0xc3, 0xa7, 0xd5, 0xcf, 0xe0, 0x3b, 0x3d, 0xf2, 0x6d, 0x65, 0x9d, 0xb6,
+  0xd0, 0xbb, 0x80, 0x64, 0xc8, 0xf7, 0x3f, 0xb7, 0xc9, 0xbf, 0xfe, 0x0f, 0xf9, 0xe4, 0x3a, 0xd2,
+  0x12, 0xe6, 0x21, 0x1a, 0x09, 0xab, 0xe0, 0x60, 0xdb, 0x4d, 0x93, 0xe7, 0xd5, 0xf8, 0x61, 0xbe,
+  0xb8, 0x99, 0x33, 0xae, 0x82, 0x6f, 0x5f, 0xe7, 0x6a, 0xab, 0x99, 0xc1, 0xe0, 0x3d, 0x0a, 0x88,
+  0xeb, 0x9b, 0xd2, 0x7c, 0xa1, 0xea, 0x2e, 0x5a, 0xd4, 0x31, 0xd6, 0xb7, 0x3b, 0x80, 0x19, 0x1f,
+  0xc8, 0x9c, 0x42, 0xe3, 0xce, 0x83, 0x85, 0x84, 0x7b, 0x11, 0x1a, 0x56, 0xdd, 0x5d, 0x82, 0xce,
+  0x44, 0xf2, 0xb0, 0x0c, 0xc0, 0xdc, 0x88, 0xee, 0x74, 0x31, 0xde, 0x6b, 0x13, 0x51, 0x51, 0x2b,
+  0xa9, 0x0b, 0xe5, 0xfb, 0xd4, 0xa4, 0x74, 0x03, 0x4b, 0x8d, 0x95, 0x0f, 0x30, 0xda, 0xc1, 0x61,
+  0xca, 0x6e, 0x0f, 0xd2, 0x6a, 0x0e, 0x4a, 0x50, 0x48, 0xf7, 0xdd, 0xa9, 0x9e, 0xf1, 0x2f, 0xd1,
+  0xae, 0xd4, 0x8b, 0x4e, 0x6e, 0xda, 0x04, 0x31, 0x96, 0x50, 0x7e, 0x1a, 0xc7, 0x89, 0xc2, 0x78,
+  0xf9, 0x00, 0xe1, 0x9c, 0xd1, 0xe8, 0x96, 0x39, 0x32, 0xbe, 0x1a, 0x0a, 0xd0, 0x79, 0x65, 0x40,
+  0x5c, 0x01, 0x99, 0x10, 0xb0, 0x63, 0xc4, 0x20, 0x5a, 0x07, 0x26, 0x29, 0x7c, 0x0e, 0xbc, 0xde,
+  0x52, 0xb9, 0xea, 0x80, 0x52, 0xad, 0x0e, 0x6c, 0xf3, 0xf8, 0x00, 0x3b, 0xbd, 0x4a, 0xfb, 0xc0,
+  0x64, 0xba, 0x8d, 0x3e, 0xc4, 0x6d, 0x14, 0xe0, 0xb9, 0x0d, 0xa3, 0x5a, 0xe4, 0x9f, 0xff, 0x2c,
+  0xde, 0x0b, 0xd2, 0x14, 0x51, 0x03, 0xf7, 0x08, 0xe1, 0xef, 0xc9, 0x9f, 0x88, 0xb5, 0x83, 0xde,
+  0x60, 0xe7, 0x2e, 0x8a, 0x82, 0x4f, 0xa6, 0x11, 0x88, 0xc3, 0xb6, 0x38, 0x62, 0x05, 0x5d, 0x06,
+  0xf0, 0x63, 0x6d, 0x63, 0x1e, 0x5d, 0x2d, 0x06, 0xd0, 0xc1, 0xa6, 0xf3, 0x56, 0x59, 0x0f, 0x58,
+  0x01, 0x9f, 0x21, 0xa6, 0x43, 0x2c, 0x57, 0xf1, 0x1b, 0x45, 0xa3, 0x56, 0xb3, 0x3c, 0x70, 0xce,
+  0x96, 0x5e, 0xf0, 0x1e, 0x26, 0x57, 0x8c, 0xa6, 0x6a, 0x92, 0x1d, 0x00, 0x30, 0xaf, 0xa8, 0xb3,
+  0xb2, 0xac, 0x6d, 0x9b, 0xdc, 0xab, 0x8c, 0x04, 0x07, 0xa1, 0x73, 0xdd, 0x71, 0xeb, 0xc1, 0xba,
+  0x07, 0x0d, 0x3d, 0x5a, 0xdb, 0x56, 0xf1, 0xf7, 0x2c, 0x53, 0xdc, 0x83, 0xee, 0xae, 0x66, 0x7c,
+  0x05, 0x8f, 0x53, 0x2c, 0xde, 0x93, 0x7b, 0xdb, 0x6e, 0x99, 0xa8, 0x28, 0x8d, 0x7f, 0xb8, 0xff,
+  0xd8, 0xaa, 0x98, 0x9e, 0x65, 0xf8, 0x2e, 0x64, 0xc4, 0xef, 0x59, 0x3a, 0xf1, 0xf8, 0x46, 0xd2,
+  0x89, 0xd3, 0x44, 0xff, 0x7a, 0xe2, 0x3c, 0xf7, 0x32, 0x58, 0xad, 0xaa, 0xf5, 0xab, 0x16, 0x9a,
+  0xfa, 0x35, 0x73, 0x29, 0xf4, 0x45, 0x8d, 0xae, 0x5a, 0x3e, 0x57, 0x19, 0xe0, 0xd8, 0x27, 0x00,
+  0x23, 0xf1, 0x78, 0x83, 0xfa, 0x82, 0xa7, 0x47, 0x1a, 0x1a, 0x5a, 0xaa, 0xdd, 0x5d, 0x94, 0x17,
+  0x71, 0xe6, 0x44, 0xad, 0xa2, 0x26, 0xad, 0xd8, 0x7c, 0x8b, 0x74, 0xd5, 0xb1, 0x43, 0x7a, 0x88,
+  0x82, 0x65, 0x6a, 0x07, 0x66, 0xcb, 0xc6, 0x88, 0xfb, 0x6d, 0xf5, 0x58, 0x53, 0xa9, 0x4e, 0x2f,
+  0x92, 0x80, 0x56, 0x92, 0xe7, 0xce, 0x4f, 0x82, 0x07, 0x56, 0xab, 0x6a, 0x88, 0x82, 0x25, 0x95,
+  0xe5, 0xed, 0xa7, 0xa1, 0xe2, 0x02, 0xe0, 0x3c, 0x0c, 0x8c, 0x4f, 0x07, 0xc8, 0x75, 0x14, 0xbe,
+  0xca, 0x1c, 0x34, 0x25, 0xe9, 0x8f, 0x32, 0x59, 0xed, 0xee, 0x9c, 0x17, 0xfa, 0x40, 0x40, 0x3b,
+  0x80, 0x79, 0xf6, 0x83, 0x85, 0xef, 0x39, 0xcc, 0xb2, 0x53, 0xcc, 0xd4, 0xc1, 0xca, 0x7b, 0x24,
+  0x30, 0x03, 0x56, 0x25, 0x04, 0xc4, 0x6f, 0xb1, 0x1f, 0xd7, 0x32, 0xc0, 0x3f, 0xd6, 0x2f, 0x31,
+  0xf6, 0xd3, 0x83, 0x62, 0x74, 0xa7, 0x80, 0xdd, 0x07, 0xb5, 0x72, 0xe1, 0xe7, 0xfe, 0x23, 0x78,
+  0x47, 0xab, 0x5e, 0xd8, 0x03, 0x30, 0xcb, 0xbc, 0x4d, 0xe6, 0xa0, 0x40, 0x7e, 0x53, 0x32, 0x93,
+  0x30, 0x0f, 0xcf, 0x9d, 0x01, 0x66, 0x5e, 0x20, 0x36, 0x17, 0xec, 0xf4, 0x6b, 0x4f, 0x8f, 0xf4,
+  0x62, 0x3e, 0xfe, 0x4c, 0x22, 0x7b, 0x6e, 0x52, 0xb1, 0x4a, 0x69, 0xe8, 0x35, 0x7f, 0xfb, 0x15,
+  0xa9, 0xcd, 0x73, 0xd2, 0x5c, 0x63, 0xd8, 0x7a, 0xca, 0x51, 0x19, 0xc4, 0xb8, 0xf7, 0x3a, 0x33,
+  0x29, 0x4d, 0x57, 0xad, 0xa1, 0xfc, 0xa1, 0xb0, 0x69, 0xd1, 0xe4, 0x7b, 0x28, 0xb8, 0x27, 0x93,
+  0x37, 0x6b, 0xaf, 0xcd, 0x36, 0xde, 0xd0, 0x2b, 0xfe, 0xc6, 0xc2, 0xe7, 0xe3, 0x4a, 0x49, 0xc9,
+  0xcd, 0x9d, 0x52, 0x21, 0xa9, 0xa9, 0xbe, 0x1e, 0x59, 0x86, 0x4c, 0xae, 0x9f, 0x94, 0xa9, 0xc4,
+  0xd7, 0x51, 0x9a, 0x55, 0x1b, 0xc2, 0x2c, 0xa0, 0xa1, 0x58, 0x71, 0xd8, 0x0d, 0xb0, 0x24, 0x09,
+  0x6e, 0xaa, 0xae, 0xa1, 0x77, 0xe3, 0x43, 0x71, 0x82, 0x42, 0xe8, 0x1b, 0x7c, 0xbb, 0x95, 0x07,
+  0xfb, 0x9a, 0x07, 0x71, 0x52, 0x90, 0x4d, 0x40, 0xb7, 0xd4, 0xf3, 0x73, 0x99, 0x5e, 0x5e, 0xf1,
+  0x33, 0x35, 0xde, 0xac, 0xf7, 0x9d, 0x17, 0xb8, 0x7c, 0xd7, 0x79, 0xb5, 0x05, 0x11, 0x67, 0x7c,
+  0x13, 0x39, 0xcc, 0xa4, 0xfb, 0xbc, 0xfd, 0xae, 0x0c, 0x99, 0x54, 0x19, 0x3e, 0xe5, 0x75, 0xae,
+  0xe7, 0x10, 0xd7, 0xe4, 0x32, 0xdc, 0xd4, 0x01, 0x29, 0x36, 0x15, 0x31, 0xa0, 0xfe, 0xda, 0xe1,
+  0x01, 0x0f, 0x99, 0xc2, 0x59, 0x15, 0xa7, 0xa2, 0x0a, 0xe7, 0x15, 0xfc, 0x20, 0x75, 0xa3, 0xab,
+  0xc3, 0x5e, 0x14, 0x6c, 0x7c, 0xff, 0x84, 0xdc, 0xaf, 0xda, 0x45, 0xe2, 0x69, 0x9c, 0x40, 0xeb,
+  0x14, 0x47, 0x51, 0x1a, 0xad, 0xd0, 0xd0, 0x9a, 0x09, 0x41, 0x97, 0x88, 0x73, 0xe2, 0x75, 0xaf,
+  0x8a, 0xa8, 0xff, 0x33, 0xbb, 0x79, 0xd7, 0x09, 0xf1, 0x7f, 0x61, 0x63, 0x31, 0xf5, 0xcb, 0x9a,
+  0xad, 0x2a, 0x0d, 0xeb, 0x5f, 0xbf, 0xae, 0x56, 0x71, 0xdc, 0xd1, 0xf1, 0xb9, 0x60, 0x26, 0xeb,
+  0x1f, 0xf2, 0x0e, 0x58, 0xa8, 0x58, 0x76, 0xe5, 0x1b, 0x69, 0x65, 0xfc, 0xb1, 0x4d, 0x86, 0x3d,
+  0xc3, 0x4a, 0xad, 0x5c, 0x1b, 0xea, 0x74, 0x3e, 0xa4, 0x42, 0x78, 0x5b, 0x96, 0x24, 0xc8, 0x98,
+  0xc7, 0x84, 0x38, 0x75, 0x55, 0xa1, 0xb5, 0x02, 0x3c, 0x69, 0x8e, 0x6b, 0x8e, 0xb0, 0x2e, 0xa4,
+  0xe7, 0x93, 0xd9, 0xdd, 0x9f, 0x6f, 0xef, 0x70, 0x99, 0x84, 0x10, 0x0e, 0x05, 0x73, 0xf7, 0x71,
+  0x2e, 0xf6, 0x7c, 0xea, 0xba, 0xca, 0x1d, 0xdf, 0x78, 0x02, 0xb4, 0x0f, 0x7a, 0x6b, 0xbe, 0xbc,
+  0x79, 0x1b, 0x9b, 0xe2, 0x0d, 0x50, 0x65, 0x2e, 0x04, 0x38, 0x93, 0x66, 0xaa, 0xaf, 0x1e, 0xe4,
+  0x16, 0x5d, 0xe1, 0x97, 0xcc, 0xf6, 0xd0, 0xac, 0x78, 0x1c, 0xb1, 0x0f, 0x66, 0x69, 0x27, 0x1d,
+  0xcb, 0xb2, 0x2a, 0x4a, 0xaa, 0x27, 0x93, 0x6e, 0x72, 0x27, 0x67, 0xd2, 0xd5, 0xb7, 0x8b, 0x27,
+  0x5d, 0xf5, 0xff, 0x35, 0xfa, 0x7f, 0xaf, 0xc1, 0xb4, 0x81, 0xe7, 0x48, 0x00, 0x00,
+};
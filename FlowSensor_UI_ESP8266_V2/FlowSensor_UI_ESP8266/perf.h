@@ -0,0 +1,102 @@
+#pragma once
+#include <Arduino.h>
+
+// Loop profiling
+// Times the hot paths of the sampling/recording pipeline with micros() and
+// prints a summary every PERF_REPORT_MS. Set to 0 to compile it out.
+#ifndef ENABLE_PROFILING
+#define ENABLE_PROFILING  1
+#endif
+
+#define PERF_REPORT_MS    60000UL     // Report window (1 min)
+
+enum PerfSection : uint8_t {
+  PERF_ACQ_STEP = 0,
+  PERF_PUSH_SAMPLE,
+  PERF_MEANS_1S,
+  PERF_METRICS_10S,
+  PERF_RECORD,
+  PERF_API,
+  PERF_SSE,
+  PERF_UDP,
+  PERF_FFT,
+  PERF_EVENTS,
+  PERF_LOOP,
+  PERF_COUNT
+};
+
+static const char* const PERF_NAMES[PERF_COUNT] = {
+  "acq_step", "push_sample", "compute_1s_means", "compute_10s_metrics",
+  "record_if_due", "_handle_api", "sse_push", "udp_push", "spectrum", "events_loop", "loop"
+};
+
+struct PerfStat {
+  uint32_t calls;
+  uint32_t total_us;
+  uint32_t max_us;
+};
+
+static PerfStat perf_cur[PERF_COUNT];    // Window being accumulated
+static PerfStat perf_last[PERF_COUNT];   // Last completed window (served by /perf)
+static uint32_t perf_overruns      = 0;  // loop() passes longer than the sample budget
+static uint32_t perf_last_overruns = 0;
+static unsigned long perf_window_start_ms = 0;
+static unsigned long perf_last_window_ms  = PERF_REPORT_MS;
+
+inline void perf_record(PerfSection s, uint32_t us) {
+  PerfStat& p = perf_cur[s];
+  p.calls++;
+  p.total_us += us;
+  if (us > p.max_us) p.max_us = us;
+}
+
+// Scoped timer: records the time from construction to end of scope
+struct PerfScope {
+#if ENABLE_PROFILING
+  PerfSection s;
+  uint32_t t0;
+  explicit PerfScope(PerfSection sec) : s(sec), t0(micros()) {}
+  ~PerfScope() { perf_record(s, micros() - t0); }
+#else
+  explicit PerfScope(PerfSection) {}
+#endif
+};
+
+// The host benchmark (host/bench_pipeline.cpp) substitutes its own timer
+#ifndef PERF_SCOPE
+#define PERF_SCOPE(sec) PerfScope _perf_scope_##sec(sec)
+#endif
+
+// Count a loop pass against the sample budget
+inline void perf_loop_pass(uint32_t us, uint32_t budget_us) {
+#if ENABLE_PROFILING
+  perf_record(PERF_LOOP, us);
+  if (us > budget_us) perf_overruns++;
+#endif
+}
+
+// Close the window and print per-call and per-hour cost on the serial port
+inline void perf_report_if_due() {
+#if ENABLE_PROFILING
+  unsigned long now = millis();
+  unsigned long window_ms = now - perf_window_start_ms;
+  if (window_ms < PERF_REPORT_MS) return;
+  perf_window_start_ms = now;
+
+  Serial.printf("[perf] window %lu ms, overruns %u\n", window_ms, perf_overruns);
+  for (int i = 0; i < PERF_COUNT; i++) {
+    const PerfStat& p = perf_cur[i];
+    if (p.calls == 0) continue;
+    // Extrapolate CPU time spent in this section per hour of operation
+    float ms_per_hour = (float)p.total_us / window_ms * 3600.0f;
+    Serial.printf("[perf] %-20s calls %6u  avg %6u us  max %6u us  %8.1f ms/h\n",
+                  PERF_NAMES[i], p.calls, p.total_us / p.calls, p.max_us, ms_per_hour);
+  }
+
+  memcpy(perf_last, perf_cur, sizeof(perf_cur));
+  memset(perf_cur, 0, sizeof(perf_cur));
+  perf_last_overruns = perf_overruns;
+  perf_last_window_ms = window_ms;
+  perf_overruns = 0;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#include <Arduino.h>
+#include "sensors.h"
+
+// --- Flow control ---
+// One PID controller per sensor driving a PWM output (pump or valve). It
+// runs in sample_20hz() right after each 20 Hz sample is pushed, so its
+// period is exactly SAMPLE_MS and the output follows the bus read within
+// one acquisition tick, with no HTTP round trip. The flow it sees lags the
+// pipe by the decimator's group delay (CIC_DELAY_US, 60 ms) on top of
+// that; the latency in PidTiming leaves it out. Setpoints and gains are
+// set at runtime over /pid/<n>; every controller starts disabled with its
+// output off.
+
+#define PID_PWM_RANGE      1000   // analogWrite() steps for 0..100 %
+#define PID_PWM_FREQ       1000   // Hz
+#define PID_FAULT_SAMPLES  10     // Bad reads in a row before the output is switched off (0.5 s)
+
+// PWM pin of sensor 1, 2, ...; sensors past the table have no controller
+static constexpr uint8_t PID_PWM_PINS[] = { 14, 12, 13, 15 };   // D5, D6, D7, D8
+static constexpr uint8_t PID_CHANNELS =
+  (NUM_SENSORS < sizeof(PID_PWM_PINS)) ? NUM_SENSORS : sizeof(PID_PWM_PINS);
+
+struct PidController {
+  bool    enabled;
+  float   setpoint;    // mL/min
+  float   kp;          // % output per mL/min of error
+  float   ki;          // % per mL/min per second
+  float   kd;          // % per mL/min/s
+  float   integral;    // Integral term, %
+  float   flow;        // Last measurement, mL/min
+  bool    primed;      // flow holds a previous measurement (derivative)
+  uint8_t faults;      // Bad reads in a row
+  float   output;      // %
+};
+
+static PidController _pid[PID_CHANNELS] = {};
+
+// Sample-to-actuation timing of the control steps
+struct PidTiming {
+  uint32_t updates;
+  uint32_t periods;          // Updates that followed another one
+  bool     running;          // last_us is the previous actuation
+  uint32_t last_us;          // micros() of the previous actuation
+  uint32_t latency_max_us;   // From the end of the bus read to analogWrite(), without CIC_DELAY_US
+  uint64_t latency_sum_us;
+  uint32_t jitter_max_us;    // Deviation of the actuation period from SAMPLE_MS
+  uint64_t jitter_sum_us;
+};
+
+static PidTiming _pid_timing = {};
+
+static inline void _pid_write(uint8_t ch, float pct) {
+  _pid[ch].output = pct;
+  analogWrite(PID_PWM_PINS[ch], (int)lroundf(pct * PID_PWM_RANGE / 100.0f));
+}
+
+inline void pid_begin() {
+  analogWriteRange(PID_PWM_RANGE);
+  analogWriteFreq(PID_PWM_FREQ);
+  for (uint8_t ch = 0; ch < PID_CHANNELS; ch++) {
+    pinMode(PID_PWM_PINS[ch], OUTPUT);
+    _pid_write(ch, 0.0f);
+  }
+}
+
+// Switch a controller on (bumpless from zero) or off (output off)
+inline void pid_enable(uint8_t ch, bool on) {
+  PidController& c = _pid[ch];
+  c.enabled  = on;
+  c.integral = 0.0f;
+  c.primed   = false;
+  c.faults   = 0;
+  _pid_write(ch, 0.0f);
+}
+
+// One control step per controller for a new sample; read_done_us is when
+// the bus read the sample came from finished
+inline void pid_update(const FlowReading readings[], uint32_t read_done_us) {
+  const float dt = SAMPLE_MS / 1000.0f;
+  bool active = false;
+
+  for (uint8_t ch = 0; ch < PID_CHANNELS; ch++) {
+    PidController& c = _pid[ch];
+    if (!c.enabled) continue;
+    active = true;
+
+    const FlowReading& r = readings[ch];
+    if (!(r.ok && r.enabled)) {
+      // Hold the output through short dropouts, fail safe after that
+      if (++c.faults >= PID_FAULT_SAMPLES) {
+        c.faults = PID_FAULT_SAMPLES;
+        c.primed = false;
+        _pid_write(ch, 0.0f);
+      }
+      continue;
+    }
+    c.faults = 0;
+
+    float flow = flow_from_raw(ch, r.flow_raw);
+    float err  = c.setpoint - flow;
+    // Derivative on the measurement, so setpoint steps do not kick
+    float deriv = c.primed ? -(flow - c.flow) / dt : 0.0f;
+    c.flow   = flow;
+    c.primed = true;
+
+    // Anti-windup: the integral only grows while the output is not
+    // saturated in the same direction
+    float integral = c.integral + c.ki * err * dt;
+    float u = c.kp * err + integral + c.kd * deriv;
+    if (u > 100.0f) {
+      u = 100.0f;
+      if (err < 0) c.integral = integral;
+    } else if (u < 0.0f) {
+      u = 0.0f;
+      if (err > 0) c.integral = integral;
+    } else {
+      c.integral = integral;
+    }
+    _pid_write(ch, u);
+  }
+  if (!active) {
+    _pid_timing.running = false;
+    return;
+  }
+
+  uint32_t now = micros();
+  uint32_t latency = now - read_done_us;
+  _pid_timing.latency_sum_us += latency;
+  _pid_timing.latency_max_us = max(_pid_timing.latency_max_us, latency);
+  if (_pid_timing.running) {
+    int32_t dev = (int32_t)(now - _pid_timing.last_us) - (int32_t)(SAMPLE_MS * 1000);
+    uint32_t jitter = (uint32_t)abs(dev);
+    _pid_timing.jitter_sum_us += jitter;
+    _pid_timing.jitter_max_us = max(_pid_timing.jitter_max_us, jitter);
+    _pid_timing.periods++;
+  }
+  _pid_timing.running = true;
+  _pid_timing.last_us = now;
+  _pid_timing.updates++;
+}
\ No newline at end of file
@@ -0,0 +1,490 @@
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "sensors.h"
+
+// --- Binary run file ---
+// RunFileHeader, then one RunScale per sensor in the topology, then
+// delta-encoded records. A record carries the ms since run start and the
+// int16 flow and temperature words of every sensor in the run's mask
+// (ascending sensor index, flow then temperature). Each record starts with
+// a varint tag = (x << 1) | key:
+//   key = 1  keyframe: x = flags (RUN_KEY_GAP), then uint32 t_ms and every
+//                      word as a raw int16
+//   key = 0  delta:    x = dt, t_ms = previous + dt, then every word as a
+//                      zigzag varint of its difference to the previous record
+// A keyframe is written every RUN_KEYFRAME_EVERY records so a reader can
+// resynchronise without decoding from the start. Fixed fields are
+// little-endian, as laid out in ESP8266 memory. CSV is produced from this
+// on download, so nothing is formatted while recording.
+
+#define RUN_MAGIC          0x4E555246UL   // "FRUN"
+#define RUN_VERSION        2              // 1: fixed-width records
+#define RUN_WRITE_BUF      512            // Write-behind buffer: two LittleFS pages
+#define RUN_KEYFRAME_EVERY 64             // Records per keyframe
+#define RUN_KEY_GAP        0x01           // Keyframe flag: records are missing before it
+
+// What a run records
+enum RecordMode : uint8_t {
+  RECORD_AVG = 0,   // 0.5 s means (RECORD_MS)
+  RECORD_RAW,       // Every 20 Hz sample (SAMPLE_MS)
+};
+
+struct RunFileHeader {
+  uint32_t magic;
+  uint8_t  version;
+  uint8_t  num_sensors;    // Sensors in the topology (CSV columns)
+  uint16_t record_ms;      // Nominal record interval
+  uint64_t sensor_mask;    // Bit i set: sensor i is recorded
+};
+
+struct RunScale {
+  float flow;
+  float temp;
+};
+
+// Words per record at most: flow and temperature of every sensor
+static const size_t RUN_WORDS_MAX = 2 * NUM_SENSORS;
+
+// Largest record as encoded: 5-byte tag + 4-byte time (keyframe), or a
+// 3-byte varint per word (delta of two int16 needs 17 bits)
+static const size_t RUN_ENCODED_MAX = 5 + max(4 + 2 * RUN_WORDS_MAX, 3 * RUN_WORDS_MAX);
+static_assert(RUN_ENCODED_MAX <= RUN_WRITE_BUF, "A record must fit in the read/write buffer");
+
+inline uint8_t run_mask_count(uint64_t mask) {
+  return (uint8_t)__builtin_popcountll(mask);
+}
+
+// Bytes before the first record
+inline size_t run_data_offset(uint8_t num_sensors) {
+  return sizeof(RunFileHeader) + num_sensors * sizeof(RunScale);
+}
+
+inline size_t run_put_varint(uint8_t* out, uint32_t v) {
+  size_t n = 0;
+  while (v >= 0x80) {
+    out[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  out[n++] = (uint8_t)v;
+  return n;
+}
+
+// Reads at most `avail` bytes; 0 if the varint does not end within them
+// or is longer than 5 bytes
+inline size_t run_get_varint(const uint8_t* in, size_t avail, uint32_t& v) {
+  v = 0;
+  for (size_t n = 0; n < avail && n < 5; n++) {
+    uint8_t b = in[n];
+    v |= (uint32_t)(b & 0x7F) << (7 * n);
+    if (!(b & 0x80)) return n + 1;
+  }
+  return 0;
+}
+
+inline uint32_t run_zigzag(int32_t d) { return ((uint32_t)d << 1) ^ (uint32_t)(d >> 31); }
+inline int32_t run_unzigzag(uint32_t z) { return (int32_t)(z >> 1) ^ -(int32_t)(z & 1); }
+
+// Delta encoder state of one run
+struct RunEncoder {
+  uint32_t t_prev;
+  int16_t  prev[RUN_WORDS_MAX];
+  uint16_t since_key;
+  uint8_t  key_flags;   // Flags of the next keyframe
+
+  void reset() {
+    since_key = 0;
+    key_flags = 0;
+  }
+
+  size_t encode(uint8_t* out, uint32_t t_ms, const int16_t words[], uint8_t n) {
+    size_t len;
+    if (since_key == 0) {
+      len = run_put_varint(out, ((uint32_t)key_flags << 1) | 1);
+      key_flags = 0;
+      memcpy(out + len, &t_ms, 4);
+      len += 4;
+      memcpy(out + len, words, 2 * n);
+      len += 2 * n;
+    } else {
+      len = run_put_varint(out, (t_ms - t_prev) << 1);
+      for (uint8_t k = 0; k < n; k++) {
+        len += run_put_varint(out + len, run_zigzag((int32_t)words[k] - prev[k]));
+      }
+    }
+    t_prev = t_ms;
+    memcpy(prev, words, 2 * n);
+    if (++since_key == RUN_KEYFRAME_EVERY) since_key = 0;
+    return len;
+  }
+};
+
+// Appends to a run file through one open handle. Bytes are collected in RAM
+// and written in blocks that end on RUN_WRITE_BUF file offsets, so every
+// flash write after the header starts on a page boundary and a 0.5 s
+// record costs a memcpy.
+struct RunWriter {
+  File     file;
+  uint8_t  buf[RUN_WRITE_BUF];
+  uint16_t len;
+  uint32_t bytes;       // Total bytes appended (file size once flushed)
+  uint32_t writes;      // Flash writes issued
+  uint32_t records;     // Records appended
+  uint8_t  words;       // Words per record
+  bool     failed;      // A flash write came up short; the file is incomplete
+  RunEncoder enc;
+
+  // Last record boundary handed to the file system (checkpoint candidate)
+  uint32_t flushed_end;
+  uint32_t flushed_records;
+  uint32_t flushed_t_ms;
+  uint32_t last_t_ms;
+
+  // Start a run file. The header is synced right away so a run that is
+  // cut short always has a readable file; if it cannot be written, no file
+  // is left behind.
+  bool open(const char* path, const RunFileHeader& h) {
+    file = LittleFS.open(path, "w");
+    if (!file) return false;
+    begin(h, 0, 0, 0);
+    append(&h, sizeof(h));
+    for (uint8_t i = 0; i < h.num_sensors; i++) {
+      RunScale sc = { SENSOR_TOPOLOGY[i].flow_scale, SENSOR_TOPOLOGY[i].temp_scale };
+      append(&sc, sizeof(sc));
+    }
+    flush();
+    sync();
+    if (failed) {
+      file.close();
+      LittleFS.remove(path);
+      return false;
+    }
+    flushed_end = bytes;
+    return true;
+  }
+
+  // Continue a run file that has been cut back to a record boundary; the
+  // first record written is a keyframe flagged as following a gap
+  bool resume(const char* path, const RunFileHeader& h, uint32_t end, uint32_t recs, uint32_t t_ms) {
+    file = LittleFS.open(path, "a");
+    if (!file) return false;
+    begin(h, end, recs, t_ms);
+    mark_gap();
+    return true;
+  }
+
+  // Records are missing before the next one: make it a keyframe flagged
+  // RUN_KEY_GAP
+  void mark_gap() {
+    enc.since_key = 0;
+    enc.key_flags = RUN_KEY_GAP;
+  }
+
+  void begin(const RunFileHeader& h, uint32_t end, uint32_t recs, uint32_t t_ms) {
+    len = 0;
+    bytes = end;
+    writes = 0;
+    records = recs;
+    failed = false;
+    words = 2 * run_mask_count(h.sensor_mask);
+    enc.reset();
+    flushed_end = end;
+    flushed_records = recs;
+    flushed_t_ms = t_ms;
+    last_t_ms = t_ms;
+  }
+
+  void append(const void* data, size_t n) {
+    const uint8_t* p = (const uint8_t*)data;
+    while (n > 0) {
+      size_t k = min(n, (size_t)(RUN_WRITE_BUF - bytes % RUN_WRITE_BUF));
+      memcpy(buf + len, p, k);
+      len += k;
+      bytes += k;
+      p += k;
+      n -= k;
+      if (bytes % RUN_WRITE_BUF == 0) flush();
+    }
+  }
+
+  // Encode and append one record of `words` words
+  void append_record(uint32_t t_ms, const int16_t w[]) {
+    uint8_t rec[RUN_ENCODED_MAX];
+    uint32_t start = bytes;
+    uint32_t w0 = writes;
+    append(rec, enc.encode(rec, t_ms, w, words));
+    records++;
+
+    // A flush inside this record leaves the previous one as the last
+    // complete record in the file
+    if (len == 0) {
+      flushed_end = bytes;
+      flushed_records = records;
+      flushed_t_ms = t_ms;
+    } else if (writes != w0) {
+      flushed_end = start;
+      flushed_records = records - 1;
+      flushed_t_ms = last_t_ms;
+    }
+    last_t_ms = t_ms;
+  }
+
+  // Size the records would take as fixed-width (version 1) records, over
+  // their encoded size
+  float compression_ratio(uint8_t num_sensors) {
+    uint32_t enc_bytes = bytes - run_data_offset(num_sensors);
+    return enc_bytes ? (float)records * (4 + 2 * words) / enc_bytes : 0;
+  }
+
+  void flush() {
+    if (!file || len == 0) return;
+    if (file.write(buf, len) != len) failed = true;
+    writes++;
+    len = 0;
+  }
+
+  // Commit everything written so far; LittleFS keeps unsynced data out of
+  // the file if power is lost
+  void sync() {
+    if (file) file.flush();
+  }
+
+  void close() {
+    flush();
+    if (file) file.close();
+  }
+
+  bool is_open() { return (bool)file; }
+};
+
+// Read and check the header and scale table of a run file
+inline bool run_read_header(File& f, RunFileHeader& h, RunScale scales[NUM_SENSORS]) {
+  if (f.read((uint8_t*)&h, sizeof(h)) != sizeof(h)) return false;
+  if (h.magic != RUN_MAGIC || h.version != RUN_VERSION || h.num_sensors > NUM_SENSORS) return false;
+  if (h.num_sensors < 64 && (h.sensor_mask >> h.num_sensors)) return false;   // Sensors beyond the table
+  size_t n = h.num_sensors * sizeof(RunScale);
+  return f.read((uint8_t*)scales, n) == n;
+}
+
+// Streams the records of a run file back out, reading it in blocks
+struct RunDecoder {
+  File*    file;
+  uint8_t  buf[RUN_WRITE_BUF];
+  uint16_t len, pos;
+  uint8_t  words;
+  uint32_t t_prev;
+  int16_t  prev[RUN_WORDS_MAX];
+  bool     synced;     // A keyframe has been seen
+  bool     gap;        // Records are missing before the last one returned
+
+  void begin(File& f, const RunFileHeader& h) {
+    file = &f;
+    len = pos = 0;
+    words = 2 * run_mask_count(h.sensor_mask);
+    synced = false;
+  }
+
+  // Next record; false at end of file or on a truncated or corrupt record.
+  // Every field is checked against the bytes in the buffer before it is read.
+  bool next(uint32_t& t_ms, int16_t w[]) {
+    while (true) {
+      if ((size_t)(len - pos) < RUN_ENCODED_MAX) {
+        memmove(buf, buf + pos, len - pos);
+        len -= pos;
+        pos = 0;
+        len += file->read(buf + len, sizeof(buf) - len);
+      }
+      if (pos >= len) return false;
+
+      const uint8_t* p = buf + pos;
+      size_t avail = len - pos;
+      uint32_t tag;
+      size_t n = run_get_varint(p, avail, tag);
+      if (n == 0) return false;
+      if (tag & 1) {
+        if (n + 4 + 2 * words > avail) return false;
+        memcpy(&t_ms, p + n, 4);
+        memcpy(w, p + n + 4, 2 * words);
+        n += 4 + 2 * words;
+        synced = true;
+        gap = (tag >> 1) & RUN_KEY_GAP;
+      } else {
+        gap = false;
+        t_ms = t_prev + (tag >> 1);
+        for (uint8_t k = 0; k < words; k++) {
+          uint32_t z;
+          size_t m = run_get_varint(p + n, avail - n, z);
+          if (m == 0) return false;
+          n += m;
+          w[k] = (int16_t)(prev[k] + run_unzigzag(z));
+        }
+      }
+      pos += n;
+      t_prev = t_ms;
+      memcpy(prev, w, 2 * words);
+      if (synced) return true;
+    }
+  }
+};
+
+// CSV header line for a run, one flow/temp column pair per sensor
+inline size_t run_csv_header(char* out, size_t cap, const RunFileHeader& h) {
+  size_t n = snprintf(out, cap, "time_s");
+  for (int i = 0; i < h.num_sensors && n < cap; i++) {
+    int sn = i + 1;
+    n += snprintf(out + n, cap - n, ",s%d_flow_ml_min,s%d_temp_c", sn, sn);
+  }
+  if (n < cap) n += snprintf(out + n, cap - n, "\r\n");
+  return min(n, cap);
+}
+
+// One CSV line from a decoded record; sensors outside the mask get empty
+// cells, and all cells are empty if words is null (gap marker row)
+inline size_t run_csv_row(char* out, size_t cap, uint32_t t_ms, const int16_t words[],
+                          const RunFileHeader& h, const RunScale scales[]) {
+  const int16_t* p = words;
+
+  // 20 Hz records need centiseconds
+  size_t n = snprintf(out, cap, (h.record_ms < 100) ? "%.2f" : "%.1f", t_ms / 1000.0f);
+  for (int i = 0; i < h.num_sensors && n < cap; i++) {
+    if (words && (h.sensor_mask & (1ULL << i))) {
+      int16_t fr = p[0], tr = p[1];
+      p += 2;
+      n += snprintf(out + n, cap - n, ",%.3f,%.1f", fr / scales[i].flow, tr / scales[i].temp);
+    } else {
+      n += snprintf(out + n, cap - n, ",,");  // Empty cells for disabled sensor
+    }
+  }
+  if (n < cap) n += snprintf(out + n, cap - n, "\r\n");
+  return min(n, cap);
+}
+
+// Min / max / sum of every recorded word over a span of records, for
+// downsampled history (/history)
+struct RunBucket {
+  uint32_t t_ms;       // Start of the bucket
+  uint32_t n;          // Records added
+  int16_t  lo[RUN_WORDS_MAX];
+  int16_t  hi[RUN_WORDS_MAX];
+  int64_t  sum[RUN_WORDS_MAX];
+
+  void reset(uint32_t t) {
+    t_ms = t;
+    n = 0;
+  }
+
+  void add(const int16_t w[], uint8_t words) {
+    for (uint8_t k = 0; k < words; k++) {
+      if (n == 0 || w[k] < lo[k]) lo[k] = w[k];
+      if (n == 0 || w[k] > hi[k]) hi[k] = w[k];
+      sum[k] = (n == 0 ? 0 : sum[k]) + w[k];
+    }
+    n++;
+  }
+
+  float mean(uint8_t k) const { return (float)sum[k] / n; }
+};
+
+// --- Run index ---
+// Runs are kept as /runs/<id>.bin. /runs/index.bin holds RUN_INDEX_SLOTS
+// fixed-size entries, run <id> in slot id % RUN_INDEX_SLOTS, so listing
+// runs reads this one small file and never opens the run files. An entry
+// with id 0 is free.
+#define RUN_DIR          "/runs"
+#define RUN_INDEX_FILE   "/runs/index.bin"
+#define RUN_INDEX_SLOTS  32
+
+struct RunIndexEntry {
+  uint64_t sensor_mask;
+  uint32_t id;
+  uint32_t start_unix;     // Wall-clock start, 0 if the clock was not set
+  uint32_t duration_ms;
+  uint32_t bytes;          // Run file size
+  uint32_t records;
+  uint16_t record_ms;
+  uint8_t  mode;           // RecordMode
+  uint8_t  reserved;
+};
+
+inline uint8_t run_index_slot(uint32_t id) { return id % RUN_INDEX_SLOTS; }
+
+inline void run_path(char* out, size_t cap, uint32_t id) {
+  snprintf(out, cap, RUN_DIR "/%u.bin", id);
+}
+
+// Fixed-slot index files (runs, events). Read the whole table; a missing
+// or short file reads as free slots.
+inline void index_file_load(const char* path, void* entries, size_t size) {
+  memset(entries, 0, size);
+  File f = LittleFS.open(path, "r");
+  if (!f) return;
+  f.read((uint8_t*)entries, size);
+  f.close();
+}
+
+// Write one slot back in place, creating the file on first use; false if
+// the file could not be opened or not every byte was written
+inline bool index_file_store(const char* path, const void* entries, size_t size,
+                             size_t slot, size_t entry_size) {
+  if (!LittleFS.exists(path)) {
+    File f = LittleFS.open(path, "w");
+    if (!f) return false;
+    bool ok = f.write((const uint8_t*)entries, size) == size;
+    f.close();
+    return ok;
+  }
+  File f = LittleFS.open(path, "r+");
+  if (!f) return false;
+  bool ok = f.seek(slot * entry_size, SeekSet) &&
+            f.write((const uint8_t*)entries + slot * entry_size, entry_size) == entry_size;
+  f.close();
+  return ok;
+}
+
+inline void run_index_load(RunIndexEntry entries[RUN_INDEX_SLOTS]) {
+  index_file_load(RUN_INDEX_FILE, entries, sizeof(RunIndexEntry) * RUN_INDEX_SLOTS);
+}
+
+inline bool run_index_store(const RunIndexEntry entries[RUN_INDEX_SLOTS], uint8_t slot) {
+  return index_file_store(RUN_INDEX_FILE, entries, sizeof(RunIndexEntry) * RUN_INDEX_SLOTS,
+                          slot, sizeof(RunIndexEntry));
+}
+
+// --- Run journal ---
+// Checkpoint of the run being recorded: a record boundary that has been
+// synced to flash. Rewritten every RUN_CHECKPOINT_MS and removed when the
+// run stops, so finding it at boot means the run was interrupted. Recovery
+// reads this file and the run header only, whatever the run's length.
+#define RUN_JOURNAL_FILE   "/runs/journal.bin"
+#define RUN_JOURNAL_MAGIC  0x4C4E524AUL    // "JRNL"
+#define RUN_CHECKPOINT_MS  10000UL
+
+struct RunJournal {
+  uint32_t magic;
+  uint32_t run_id;
+  uint32_t end;        // File size to keep
+  uint32_t records;    // Records before end
+  uint32_t t_ms;       // Time of the last record before end
+};
+
+// LittleFS commits the new contents on close, so a reset mid-write
+// leaves the previous checkpoint in place
+inline bool run_journal_store(const RunJournal& j) {
+  File f = LittleFS.open(RUN_JOURNAL_FILE, "w");
+  if (!f) return false;
+  f.write((const uint8_t*)&j, sizeof(j));
+  f.close();
+  return true;
+}
+
+inline bool run_journal_load(RunJournal& j) {
+  File f = LittleFS.open(RUN_JOURNAL_FILE, "r");
+  if (!f) return false;
+  bool ok = f.read((uint8_t*)&j, sizeof(j)) == sizeof(j) && j.magic == RUN_JOURNAL_MAGIC;
+  f.close();
+  return ok;
+}
+
+inline void run_journal_clear() {
+  LittleFS.remove(RUN_JOURNAL_FILE);
+}
\ No newline at end of file
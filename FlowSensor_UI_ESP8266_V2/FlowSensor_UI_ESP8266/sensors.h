@@ -1,29 +1,146 @@
 #pragma once
 #include <Arduino.h>
 #include <Wire.h>
+#include "perf.h"
+#include "decimator.h"
 
 // I2C Pin Configuration
 #define SDA_PIN        4          // ESP8266 D2
 #define SCL_PIN        5          // ESP8266 D1
+#define I2C_CLOCK_HZ   400000UL   // 400 kHz I2C
 
 // Sensor / Mux Configuration
 #define USE_TCA9548A   1
-#define TCA_ADDR       0x70
-#define NUM_SENSORS    4          // Using MUX channels 0, 1, 2, 3
+#define TCA_ADDR       0x70       // First mux; mux n answers at TCA_ADDR + n
+#define TCA_MAX_MUXES  8          // TCA9548A address range 0x70..0x77
+#define TCA_CHANNELS   8
 
 // Sensor I2C Address
-#define SLF3X_ADDR     0x08       // All sensors share the same address
+#define SLF3X_ADDR     0x08       // Default address of every SLF3X
 
 // Scale factors from datasheet
 #define FLOW_SCALE     500.0f
 #define TEMP_SCALE     200.0f
 
-// Sensor State Structure
+// Fast sampling 20 Hz
+static const unsigned long SAMPLE_MS = 50;   // 20 Hz
+
+// Acquisition rate per sensor. Reads at this rate pass through a CIC
+// decimator (CIC_ORDER stages) that produces the 20 Hz sample stream, so
+// pump pulsation above 10 Hz is filtered instead of aliased.
+#define ACQ_RATE_HZ    100
+#define CIC_ORDER      3
+static constexpr uint32_t ACQ_PERIOD_US  = 1000000UL / ACQ_RATE_HZ;
+static constexpr uint16_t ACQ_DECIMATION = ACQ_RATE_HZ * SAMPLE_MS / 1000;
+
+// Group delay of the decimator: a flow change shows in the 20 Hz samples
+// CIC_ORDER * (ACQ_DECIMATION - 1) / 2 acquisition periods later (60 ms)
+static constexpr uint32_t CIC_DELAY_US = CIC_ORDER * (ACQ_DECIMATION - 1) * ACQ_PERIOD_US / 2;
+
+static_assert(ACQ_RATE_HZ * SAMPLE_MS % 1000 == 0 && ACQ_DECIMATION >= 1,
+              "ACQ_RATE_HZ must be a multiple of the 20 Hz sample rate");
+static_assert(ACQ_RATE_HZ <= 500, "SLF3X acquisition above 500 Hz is not supported");
+
+// Where a sensor sits on the bus and how its words are scaled
+struct SensorSlot {
+  uint8_t mux;          // Mux index (I2C address TCA_ADDR + mux)
+  uint8_t channel;      // Mux channel 0–7
+  uint8_t addr;         // Sensor I2C address
+  float   flow_scale;
+  float   temp_scale;
+};
+
+// Sensor topology: one entry per sensor, in display order. Up to 8 muxes x
+// 8 channels; sensors with different addresses may share a channel. A
+// build may supply its own table by defining SENSOR_TOPOLOGY_FILE as a
+// header that declares SENSOR_TOPOLOGY (the host build does, see host/).
+#ifdef SENSOR_TOPOLOGY_FILE
+#include SENSOR_TOPOLOGY_FILE
+#else
+static constexpr SensorSlot SENSOR_TOPOLOGY[] = {
+  { 0, 0, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 0, 1, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 0, 2, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 0, 3, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+};
+#endif
+
+static constexpr uint8_t NUM_SENSORS = sizeof(SENSOR_TOPOLOGY) / sizeof(SENSOR_TOPOLOGY[0]);
+
+// --- Compile-time topology checks ---
+
+// Mux route (mux * 8 + channel) a sensor is reached through
+static constexpr uint8_t sensor_route(uint8_t i) {
+  return SENSOR_TOPOLOGY[i].mux * TCA_CHANNELS + SENSOR_TOPOLOGY[i].channel;
+}
+
+static constexpr uint8_t topology_num_muxes() {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (SENSOR_TOPOLOGY[i].mux + 1 > n) n = SENSOR_TOPOLOGY[i].mux + 1;
+  }
+  return n;
+}
+
+// Distinct mux channels in use (each costs one select per cycle)
+static constexpr uint8_t topology_num_routes() {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    bool seen = false;
+    for (uint8_t j = 0; j < i; j++) seen |= (sensor_route(j) == sensor_route(i));
+    if (!seen) n++;
+  }
+  return n;
+}
+
+static constexpr bool topology_valid() {
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (SENSOR_TOPOLOGY[i].mux >= TCA_MAX_MUXES || SENSOR_TOPOLOGY[i].channel >= TCA_CHANNELS) return false;
+    for (uint8_t j = 0; j < i; j++) {
+      if (sensor_route(j) == sensor_route(i) && SENSOR_TOPOLOGY[j].addr == SENSOR_TOPOLOGY[i].addr) return false;
+    }
+  }
+  return true;
+}
+
+static constexpr uint8_t NUM_MUXES = topology_num_muxes();
+
+static_assert(NUM_SENSORS >= 1 && NUM_SENSORS <= TCA_MAX_MUXES * TCA_CHANNELS,
+              "SENSOR_TOPOLOGY must list 1 to 64 sensors");
+static_assert(topology_valid(),
+              "SENSOR_TOPOLOGY: mux/channel out of range or two sensors with the same address on one channel");
+
+// Bus time budget: one acquisition cycle reads 6 bytes from every sensor,
+// selects every route once and may have to close every other mux first.
+#define BUS_BUDGET_PCT   50       // Max share of the sample period spent on I2C
+static constexpr uint32_t I2C_BITS_READ   = 9 * 7 + 2;   // Address + 6 data bytes, start/stop
+static constexpr uint32_t I2C_BITS_SELECT = 9 * 2 + 2;   // Address + control byte, start/stop
+static constexpr uint32_t CYCLE_BUS_US =
+  ((uint32_t)NUM_SENSORS * I2C_BITS_READ + (uint32_t)(topology_num_routes() + NUM_MUXES) * I2C_BITS_SELECT)
+  * 1000000UL / I2C_CLOCK_HZ;
+
+static_assert(CYCLE_BUS_US * 100 <= ACQ_PERIOD_US * BUS_BUDGET_PCT,
+              "Too many sensors for ACQ_RATE_HZ: one acquisition cycle exceeds the I2C bus budget");
+
+// Sensor State Structure: raw words, scaled with the sensor's SensorSlot
 struct FlowReading {
-  float flow_ml_min;
-  float temp_c;
-  bool  ok;
-  bool  enabled;   // reflects current toggle state
+  int16_t flow_raw;
+  int16_t temp_raw;
+  bool    ok;
+  bool    enabled;   // reflects current toggle state
+  bool    settling;  // Switched on moments ago: the filter is refilling, not a read failure
+};
+
+// Raw words (or averages of them) to mL/min and °C
+inline float flow_from_raw(uint8_t i, float raw) { return raw / SENSOR_TOPOLOGY[i].flow_scale; }
+inline float temp_from_raw(uint8_t i, float raw) { return raw / SENSOR_TOPOLOGY[i].temp_scale; }
+
+// Latest raw words read from a sensor at the acquisition rate
+struct RawReading {
+  int16_t flow;    // Last good flow word (held on a failed read)
+  int16_t temp;    // Last good temperature word
+  bool    ok;      // Last read succeeded
+  bool    fresh;   // Read since the last acquisition tick
 };
 
 // Global sensor enabled array - defined in main .ino file
@@ -47,74 +164,102 @@ static uint8_t sensirion_crc8(const uint8_t *data, uint8_t len) {
   return crc;
 }
 
-// Select mux channel 0–7
-static void _tca_select(uint8_t ch) {
-  if (ch >= NUM_SENSORS) return; // Safety check
-  Wire.beginTransmission(TCA_ADDR);
-  Wire.write(1 << ch);
-  Wire.endTransmission();
-}
-
-// --- Sensor Control Functions ---
+// Route currently connected to the sensor bus, TCA_NONE if unknown
+// (power-up, or after a bus error)
+#define TCA_NONE       0xFF
+static uint8_t  _tca_route = TCA_NONE;
+static uint8_t  _tca_open_muxes = (uint8_t)((1u << NUM_MUXES) - 1);  // Muxes that may have a channel open
 
-inline void sensors_begin() {
-  Wire.begin(SDA_PIN, SCL_PIN);
-  Wire.setClock(400000); // 400 kHz I2C
-}
+enum TcaResult : uint8_t {
+  TCA_READY = 0,    // Route already selected, no bus transaction
+  TCA_PENDING,      // One mux write done, call again
+  TCA_FAILED        // Mux did not ACK
+};
 
-inline bool sensors_start() {
-  bool ok = true;
-  // Send "start continuous measurement (water)" command 0x3608 to all sensors
-  for (uint8_t ch = 0; ch < NUM_SENSORS; ch++) {
-    _tca_select(ch);
-    delay(2);
-    Wire.beginTransmission(SLF3X_ADDR);
-    Wire.write(0x36); Wire.write(0x08);
-    ok &= (Wire.endTransmission() == 0);
-    delay(5);
+// Connect the bus to a route (mux * 8 + channel), one mux write per call.
+// Other muxes are closed first so sensors sharing an address never collide.
+static TcaResult _tca_select(uint8_t route) {
+  uint8_t mux = route / TCA_CHANNELS;
+  uint8_t others = _tca_open_muxes & ~(1u << mux);
+  if (others) {
+    uint8_t m = 0;
+    while (!(others & (1u << m))) m++;
+    Wire.beginTransmission(TCA_ADDR + m);
+    Wire.write(0);
+    Wire.endTransmission();   // An absent mux has nothing open either
+    _tca_open_muxes &= ~(1u << m);
+    return TCA_PENDING;
   }
-  return ok;
-}
 
-inline bool sensors_stop() {
-  bool ok = true;
-  // Send "stop continuous measurement" command 0x3F99 to all sensors
-  for (uint8_t ch = 0; ch < NUM_SENSORS; ch++) {
-    _tca_select(ch);
-    delay(2);
-    Wire.beginTransmission(SLF3X_ADDR);
-    Wire.write(0x3F); Wire.write(0xF9);
-    ok &= (Wire.endTransmission() == 0);
-    delay(5);
+  if (route == _tca_route) return TCA_READY;
+
+  Wire.beginTransmission(TCA_ADDR + mux);
+  Wire.write(1 << (route % TCA_CHANNELS));
+  _tca_open_muxes |= (1u << mux);
+  if (Wire.endTransmission() != 0) {
+    _tca_route = TCA_NONE;
+    return TCA_FAILED;
   }
-  return ok;
+  _tca_route = route;
+  return TCA_PENDING;
 }
 
-// Read flow & temperature from a specific sensor index (1-based)
-inline FlowReading read_sensor(uint8_t sensor_index) {
-  FlowReading r{0, 0, false, false};
+// --- Non-blocking acquisition engine ---
+// An acquisition cycle walks every sensor, but acq_step() performs at most one
+// bus transaction per call (mux write, command, or read + CRC check), so a
+// loop() pass never blocks for longer than a single short I2C transfer.
+// Sensors are visited in route order, starting at the route the muxes are
+// already on, so every route is selected at most once per cycle.
 
-  if (sensor_index < 1 || sensor_index > NUM_SENSORS) {
-    return r;
-  }
+#define SLF3X_CMD_START   0x3608    // Start continuous measurement (water)
+#define SLF3X_CMD_STOP    0x3FF9    // Stop continuous measurement
+#define SLF3X_WARMUP_MS   12        // First measurement is ready 12 ms after start
 
-  r.enabled = sensor_enabled[sensor_index - 1];
+enum AcqState : uint8_t {
+  ACQ_IDLE = 0,     // Waiting for acq_tick() or a command
+  ACQ_SELECT,       // Route the muxes to the current sensor
+  ACQ_COMMAND,      // Send the pending command to the current sensor
+  ACQ_READ          // Read flow/temp words and check CRC
+};
 
-  // If sensor is disabled, return immediately (ok=false, enabled=false)
-  if (!r.enabled) {
-    return r;
-  }
+struct AcqEngine {
+  AcqState      state;
+  uint8_t       first;       // Position in _acq_order the cycle started at
+  uint8_t       pos;         // Sensors visited so far in this cycle
+  bool          routed;      // Mux writes were needed for the current sensor
+  uint16_t      command;     // Pending command, 0 during a read cycle
+  bool          command_ok;  // All sensors ACKed the last command
+  unsigned long ready_ms;    // No read cycle before this (sensor warm-up)
+  uint32_t      skipped;     // Ticks dropped because the previous cycle was still running
+  uint32_t      selects_saved;     // Sensors whose route was already selected
+  uint32_t      bus_us;      // Time spent on the bus in the current sample period
+  uint32_t      period_start_us;
+  float         bus_util_pct;      // Bus utilisation of the last sample period
+  float         bus_util_max_pct;  // Worst period since boot
+  RawReading    raw[NUM_SENSORS];
+  uint16_t      phase;       // Acquisition ticks into the current decimation window
+  FlowReading   output[NUM_SENSORS];   // Latest decimated 20 Hz sample
+};
 
-  uint8_t ch = sensor_index - 1;
-  _tca_select(ch);
+static AcqEngine _acq = {};
+static uint8_t   _acq_order[NUM_SENSORS];   // Sensor indices sorted by route
 
+// Per-sensor decimation state
+static CicDecimator<CIC_ORDER, ACQ_DECIMATION> _cic_flow[NUM_SENSORS];
+static CicDecimator<CIC_ORDER, ACQ_DECIMATION> _cic_temp[NUM_SENSORS];
+static uint8_t _cic_good[NUM_SENSORS];     // Fresh good reads in the current window
+static uint8_t _cic_settle[NUM_SENSORS];   // Outputs left until the filter has settled
+static uint8_t _cic_warmup[NUM_SENSORS];   // Outputs since switch-on still reported as settling
+
+// Read the 6-byte flow/temp frame from a sensor on the selected route
+static bool _slf3x_read(const SensorSlot& slot, RawReading& r) {
   // We read first 2 words (flow, temp) = 2*2 bytes + 2 CRC = 6 bytes
   const uint8_t BYTES_TO_READ = 6;
   uint8_t raw[BYTES_TO_READ];
 
-  uint8_t received = Wire.requestFrom((int)SLF3X_ADDR, (int)BYTES_TO_READ);
+  uint8_t received = Wire.requestFrom((int)slot.addr, (int)BYTES_TO_READ);
   if (received != BYTES_TO_READ) {
-    return r; // NACK or not enough data
+    return false; // NACK or not enough data
   }
 
   for (uint8_t i = 0; i < BYTES_TO_READ; i++) {
@@ -123,23 +268,217 @@ inline FlowReading read_sensor(uint8_t sensor_index) {
 
   // Check CRC for flow word (raw[0], raw[1], raw[2])
   if (sensirion_crc8(&raw[0], 2) != raw[2]) {
-    return r;
+    return false;
   }
   // Check CRC for temperature word (raw[3], raw[4], raw[5])
   if (sensirion_crc8(&raw[3], 2) != raw[5]) {
-    return r;
+    return false;
   }
 
-  // Convert to signed 16-bit
-  int16_t flow_raw = (int16_t)((raw[0] << 8) | raw[1]);
-  int16_t temp_raw = (int16_t)((raw[3] << 8) | raw[4]);
+  // Convert to signed 16-bit; scaling happens only when values are reported
+  r.flow = (int16_t)((raw[0] << 8) | raw[1]);
+  r.temp = (int16_t)((raw[3] << 8) | raw[4]);
+  r.ok   = true;
+  return true;
+}
 
-  // Apply scale factors
-  r.flow_ml_min = (float)flow_raw / FLOW_SCALE;
-  r.temp_c      = (float)temp_raw / TEMP_SCALE;
-  r.ok          = true;
+// Sensor currently being serviced
+static inline uint8_t _acq_sensor() {
+  return _acq_order[(_acq.first + _acq.pos) % NUM_SENSORS];
+}
 
-  return r;
+// Start a pass over all sensors at the route the muxes are already on
+static void _acq_rewind() {
+  _acq.first = 0;
+  for (uint8_t k = 0; k < NUM_SENSORS; k++) {
+    if (sensor_route(_acq_order[k]) == _tca_route) {
+      _acq.first = k;
+      break;
+    }
+  }
+  _acq.pos = 0;
+}
+
+// Move to the next sensor that needs a bus transaction. Disabled sensors are
+// skipped during read cycles. Returns false at the end.
+static bool _acq_next_sensor() {
+  while (_acq.pos < NUM_SENSORS) {
+    uint8_t i = _acq_sensor();
+    if (_acq.command || sensor_enabled[i]) return true;
+    _acq.pos++;
+  }
+  return false;
+}
+
+// Queue a command for all sensors; it preempts a read cycle in progress
+static void _acq_command(uint16_t cmd) {
+  _acq.command    = cmd;
+  _acq.command_ok = true;
+  _acq_rewind();
+  _acq.state      = ACQ_SELECT;
+}
+
+// --- Sensor Control Functions ---
+
+inline void sensors_begin() {
+  Wire.begin(SDA_PIN, SCL_PIN);
+  Wire.setClock(I2C_CLOCK_HZ);
+
+  // Visit order: grouped by mux and channel so each route is selected once
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    uint8_t k = i;
+    while (k > 0 && sensor_route(_acq_order[k - 1]) > sensor_route(i)) {
+      _acq_order[k] = _acq_order[k - 1];
+      k--;
+    }
+    _acq_order[k] = i;
+  }
+}
+
+// Send "start continuous measurement (water)" command 0x3608 to all sensors
+inline void sensors_start() {
+  _acq_command(SLF3X_CMD_START);
+}
+
+// Send "stop continuous measurement" command 0x3FF9 to all sensors
+inline void sensors_stop() {
+  _acq_command(SLF3X_CMD_STOP);
+}
+
+// Close the bus utilisation window of the sample period that just ended
+static void _acq_close_period() {
+  uint32_t now_us = micros();
+  uint32_t period_us = now_us - _acq.period_start_us;
+  if (period_us > 0) {
+    _acq.bus_util_pct = min(100.0f, 100.0f * _acq.bus_us / period_us);
+    if (_acq.bus_util_pct > _acq.bus_util_max_pct) _acq.bus_util_max_pct = _acq.bus_util_pct;
+  }
+  _acq.bus_us = 0;
+  _acq.period_start_us = now_us;
+}
+
+// Feed the latest raw words of every sensor into its decimator. A sensor
+// whose read did not finish since the last tick repeats its previous value,
+// so the filters always run at exactly ACQ_RATE_HZ. Returns true when a
+// decimated sample is ready in _acq.output.
+static bool _acq_decimate() {
+  bool window_done = (++_acq.phase >= ACQ_DECIMATION);
+  if (window_done) _acq.phase = 0;
+
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    RawReading& r = _acq.raw[i];
+    if (!sensor_enabled[i]) {
+      // Restart from scratch when the sensor comes back
+      _cic_flow[i].reset();
+      _cic_temp[i].reset();
+      _cic_good[i]   = 0;
+      _cic_settle[i] = CIC_ORDER;
+      // The first window after switch-on may be partial
+      _cic_warmup[i] = CIC_ORDER + 1;
+      r.fresh = false;
+      if (window_done) _acq.output[i] = FlowReading{0, 0, false, false, false};
+      continue;
+    }
+
+    _cic_flow[i].integrate(r.flow);
+    _cic_temp[i].integrate(r.temp);
+    if (r.ok && r.fresh) _cic_good[i]++;
+    r.fresh = false;
+
+    if (window_done) {
+      FlowReading& out = _acq.output[i];
+      out.flow_raw = _cic_flow[i].decimate();
+      out.temp_raw = _cic_temp[i].decimate();
+      // Good if most reads in the window were fresh and valid, and the
+      // filter has seen a full impulse response of real data
+      out.ok      = (_cic_good[i] * 2 > ACQ_DECIMATION) && _cic_settle[i] == 0;
+      out.enabled = true;
+      out.settling = !out.ok && _cic_warmup[i] > 0;
+      if (_cic_warmup[i] > 0) _cic_warmup[i]--;
+      if (_cic_good[i] == 0) _cic_settle[i] = CIC_ORDER;
+      else if (_cic_settle[i] > 0) _cic_settle[i]--;
+      _cic_good[i] = 0;
+    }
+  }
+  return window_done;
+}
+
+// Acquisition tick, called every ACQ_PERIOD_US. Decimates the readings of
+// the previous period and starts the next read cycle. Returns true when a
+// new 20 Hz sample is ready in _acq.output.
+inline bool acq_tick() {
+  _acq_close_period();
+  bool sample_ready = _acq_decimate();
+
+  if (_acq.state != ACQ_IDLE) {
+    _acq.skipped++;   // Previous cycle (or a command) still on the bus
+  } else if ((long)(millis() - _acq.ready_ms) >= 0) {
+    _acq_rewind();
+    _acq.state = ACQ_SELECT;
+  }
+  return sample_ready;
+}
+
+// Advance the engine by one bus transaction. Returns true when a read cycle
+// has just completed.
+inline bool acq_step() {
+  if (_acq.state == ACQ_IDLE) return false;
+  PERF_SCOPE(PERF_ACQ_STEP);
+  uint32_t t0 = micros();
+
+  if (_acq.state == ACQ_SELECT) {
+    if (!_acq_next_sensor()) {
+      // Cycle finished
+      bool was_read = (_acq.command == 0);
+      if (_acq.command == SLF3X_CMD_START) {
+        _acq.ready_ms = millis() + SLF3X_WARMUP_MS;
+      }
+      _acq.command = 0;
+      _acq.state   = ACQ_IDLE;
+      return was_read;
+    }
+
+    uint8_t i = _acq_sensor();
+    TcaResult sel = _tca_select(sensor_route(i));
+    if (sel == TCA_FAILED) {
+      // Mux unreachable: the sensor behind it counts as a failed read
+      if (_acq.command) _acq.command_ok = false;
+      else _acq.raw[i].ok = false;
+      _acq.pos++;
+      _acq.routed = false;
+    } else if (sel == TCA_PENDING) {
+      _acq.routed = true;
+    } else {
+      // Route selected: go straight to the sensor transaction
+      if (!_acq.routed) _acq.selects_saved++;
+      _acq.state = _acq.command ? ACQ_COMMAND : ACQ_READ;
+    }
+    if (sel != TCA_READY) {
+      _acq.bus_us += micros() - t0;
+      return false;
+    }
+  }
+
+  uint8_t i = _acq_sensor();
+  const SensorSlot& slot = SENSOR_TOPOLOGY[i];
+  if (_acq.state == ACQ_COMMAND) {
+    Wire.beginTransmission(slot.addr);
+    Wire.write((uint8_t)(_acq.command >> 8)); Wire.write((uint8_t)(_acq.command & 0xFF));
+    _acq.command_ok &= (Wire.endTransmission() == 0);
+  } else {
+    RawReading& r = _acq.raw[i];
+    r.ok    = false;
+    r.fresh = true;
+    if (!_slf3x_read(slot, r)) {
+      _tca_route = TCA_NONE;  // Don't trust the cached mux state after a bus error
+    }
+  }
+
+  _acq.pos++;
+  _acq.routed = false;
+  _acq.state = ACQ_SELECT;
+  _acq.bus_us += micros() - t0;
+  return false;
 }
 
 // Toggle from web UI
@@ -0,0 +1,158 @@
+#pragma once
+#include <Arduino.h>
+#include "sensors.h"
+
+// --- Pulsation spectrum ---
+// Fixed-point radix-2 FFT over the last FFT_N samples of one sensor, used
+// to find the dominant pulsation (pump strokes, valve chatter) behind a
+// high CV. fft_load() prepares the input in one go; fft_step() then does
+// at most FFT_SLICE butterflies per call, so a transform is spread over
+// many loop() passes and never holds up acquisition.
+//
+// The input is block-scaled to 14 bits and every stage halves its output,
+// so int32 products never overflow. Frequencies up to the 10 Hz Nyquist
+// limit of the 20 Hz samples are resolved in steps of 20 Hz / FFT_N. The
+// amplitude is divided by the decimator's response at the peak, so it is
+// that of the flow itself (the filter passes half of it at 7.5 Hz).
+
+#define FFT_N        256    // 12.8 s @ 20 Hz
+#define FFT_LOG2N    8
+#define FFT_SLICE    64     // Butterflies per fft_step() call
+#define FFT_MIN_BIN  2      // Bins below are the removed mean leaking through the window
+
+static_assert((1 << FFT_LOG2N) == FFT_N, "FFT_N must be 2^FFT_LOG2N");
+
+enum FftState : uint8_t {
+  FFT_IDLE = 0,     // Waiting for fft_load()
+  FFT_BUTTERFLY,    // Stages in progress
+  FFT_PEAK          // Search for the dominant bin
+};
+
+struct FftResult {
+  float hz;         // Dominant frequency, 0 if the signal is flat
+  float amp_raw;    // Its amplitude (peak) in raw words
+};
+
+struct FftEngine {
+  FftState state;
+  uint16_t next;            // Next butterfly, 0 .. FFT_N / 2 * FFT_LOG2N
+  int8_t   shift;           // Input was multiplied by 2^shift
+  int32_t  re[FFT_N];
+  int32_t  im[FFT_N];
+  int16_t  cos_q15[FFT_N / 2];
+  int16_t  sin_q15[FFT_N / 2];
+  int16_t  hann_q15[FFT_N];
+  FftResult result;
+};
+
+static FftEngine _fft = {};
+
+static inline uint16_t _fft_bitrev(uint16_t i) {
+  uint16_t r = 0;
+  for (uint8_t b = 0; b < FFT_LOG2N; b++, i >>= 1) r = (r << 1) | (i & 1);
+  return r;
+}
+
+// Twiddle factors and window, once at boot
+inline void fft_begin() {
+  for (int k = 0; k < FFT_N / 2; k++) {
+    float a = 2.0f * (float)M_PI * k / FFT_N;
+    _fft.cos_q15[k] = (int16_t)lroundf(32767.0f * cosf(a));
+    _fft.sin_q15[k] = (int16_t)lroundf(32767.0f * sinf(a));
+  }
+  for (int n = 0; n < FFT_N; n++) {
+    _fft.hann_q15[n] = (int16_t)lroundf(32767.0f * 0.5f * (1.0f - cosf(2.0f * (float)M_PI * n / FFT_N)));
+  }
+  _fft.state = FFT_IDLE;
+}
+
+// Start a transform of the FFT_N samples ending at ring[newest]: remove the
+// mean, scale to 14 bits, apply the window and store in bit-reversed order
+inline void fft_load(const int16_t ring[], int ring_len, int newest) {
+  int first = newest - FFT_N + 1 + ring_len;
+  int32_t sum = 0;
+  for (int n = 0; n < FFT_N; n++) sum += ring[(first + n) % ring_len];
+  int32_t mean = sum / FFT_N;
+
+  int32_t peak = 0;
+  for (int n = 0; n < FFT_N; n++) peak = max(peak, abs(ring[(first + n) % ring_len] - mean));
+  int8_t shift = 0;
+  while (peak && peak < (1 << 13)) { peak <<= 1; shift++; }
+  while (peak >= (1 << 14)) { peak >>= 1; shift--; }
+  _fft.shift = shift;
+
+  for (int n = 0; n < FFT_N; n++) {
+    int32_t d = ring[(first + n) % ring_len] - mean;
+    d = (shift >= 0) ? d * (1 << shift) : d >> -shift;   // d is signed: no left shift
+    uint16_t r = _fft_bitrev(n);
+    _fft.re[r] = (d * _fft.hann_q15[n]) >> 15;
+    _fft.im[r] = 0;
+  }
+  _fft.next  = 0;
+  _fft.state = FFT_BUTTERFLY;
+}
+
+// Advance the transform by one slice. Returns true when a new result is
+// in _fft.result.
+inline bool fft_step() {
+  if (_fft.state == FFT_BUTTERFLY) {
+    const uint16_t total = FFT_N / 2 * FFT_LOG2N;
+    uint16_t end = min((uint16_t)(_fft.next + FFT_SLICE), total);
+    for (uint16_t b = _fft.next; b < end; b++) {
+      // Butterfly b: stage, then position within the stage
+      uint8_t  stage = b / (FFT_N / 2);
+      uint16_t m     = b % (FFT_N / 2);
+      uint16_t half  = 1 << stage;
+      uint16_t pos   = m & (half - 1);
+      uint16_t i     = ((m >> stage) << (stage + 1)) + pos;
+      uint16_t j     = i + half;
+      uint16_t tw    = pos << (FFT_LOG2N - 1 - stage);
+      int32_t wr = _fft.cos_q15[tw];
+      int32_t wi = -_fft.sin_q15[tw];
+      int32_t tr = ((wr * _fft.re[j]) >> 15) - ((wi * _fft.im[j]) >> 15);
+      int32_t ti = ((wr * _fft.im[j]) >> 15) + ((wi * _fft.re[j]) >> 15);
+      _fft.re[j] = (_fft.re[i] - tr) >> 1;
+      _fft.im[j] = (_fft.im[i] - ti) >> 1;
+      _fft.re[i] = (_fft.re[i] + tr) >> 1;
+      _fft.im[i] = (_fft.im[i] + ti) >> 1;
+    }
+    _fft.next = end;
+    if (end == total) _fft.state = FFT_PEAK;
+    return false;
+  }
+
+  if (_fft.state == FFT_PEAK) {
+    auto power = [](int k) -> int64_t {
+      return (int64_t)_fft.re[k] * _fft.re[k] + (int64_t)_fft.im[k] * _fft.im[k];
+    };
+    int best = FFT_MIN_BIN;
+    for (int k = FFT_MIN_BIN + 1; k < FFT_N / 2; k++) {
+      if (power(k) > power(best)) best = k;
+    }
+
+    _fft.result = { 0.0f, 0.0f };
+    if (power(best) > 0) {
+      // Peak between bins from a parabola through the log magnitudes
+      float delta = 0.0f;
+      if (best + 1 < FFT_N / 2) {
+        float a = logf((float)power(best - 1) + 1.0f);
+        float b = logf((float)power(best) + 1.0f);
+        float c = logf((float)power(best + 1) + 1.0f);
+        float den = a - 2.0f * b + c;
+        if (den < 0.0f) delta = constrain(0.5f * (a - c) / den, -0.5f, 0.5f);
+      }
+      _fft.result.hz = (best + delta) * (1000.0f / SAMPLE_MS) / FFT_N;
+
+      // Amplitude from the energy of the Hann main lobe (best +- 2 bins),
+      // independent of where the peak falls between bins: with the 1/N
+      // scaling of the stages, A = 2 sqrt(8/3 * sum |X_k|^2)
+      int64_t energy = 0;
+      for (int k = max(best - 2, 1); k <= min(best + 2, FFT_N / 2 - 1); k++) energy += power(k);
+      _fft.result.amp_raw = 2.0f * sqrtf(8.0f / 3.0f * (float)energy) / powf(2.0f, _fft.shift) /
+                            CicDecimator<CIC_ORDER, ACQ_DECIMATION>::response(_fft.result.hz / ACQ_RATE_HZ);
+    }
+    _fft.state = FFT_IDLE;
+    return true;
+  }
+  return false;
+}
\ No newline at end of file
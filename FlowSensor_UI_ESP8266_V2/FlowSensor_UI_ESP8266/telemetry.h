@@ -0,0 +1,96 @@
+#pragma once
+#include <Arduino.h>
+#include "sensors.h"
+#include "runlog.h"   // RunScale
+
+// --- Binary telemetry ---
+// Raw samples for machine consumers, served by GET /telemetry?since=N and
+// pushed over UDP (udp_push.h). One packet, all fields little-endian:
+//   TelemetryHeader
+//   RunScale[num_sensors]          divisors from raw words to mL/min and °C
+//   count records, one per 20 Hz sample, of
+//     uint8 ok[TELEM_OK_BYTES]     bit i set: sensor i read OK (else held)
+//     int16 flow, int16 temp       per sensor, ascending sensor index
+// Records are the consecutive samples first_seq, first_seq + 1, ... A
+// client that asks for since = first_seq + count next time gets every
+// sample exactly once, provided it comes back within the 20 s ring;
+// otherwise TELEM_GAP is set and `dropped` says how many it missed.
+
+#define TELEM_MAGIC    0x4C455446UL   // "FTEL"
+#define TELEM_VERSION  2
+#define TELEM_GAP      0x01           // Samples from `since` to first_seq are lost
+#define TELEM_RESET    0x02           // `since` is ahead: the device restarted (new boot_id)
+
+static const size_t TELEM_OK_BYTES    = (NUM_SENSORS + 7) / 8;
+static const size_t TELEM_RECORD_SIZE = TELEM_OK_BYTES + 4 * NUM_SENSORS;
+
+struct TelemetryHeader {
+  uint32_t magic;
+  uint8_t  version;
+  uint8_t  num_sensors;
+  uint16_t sample_ms;
+  uint32_t boot_id;      // Random per boot; sequence numbers restart with it
+  uint32_t first_seq;    // Sequence number of the first record
+  uint32_t next_seq;     // Sequence number the next sample will get
+  uint16_t count;        // Records in this packet
+  uint16_t flags;        // TELEM_GAP, TELEM_RESET
+  uint32_t dropped;      // Samples lost before first_seq (TELEM_GAP)
+  uint32_t newest_ms;    // millis() when sample next_seq - 1 was taken
+  uint32_t sent_ms;      // millis() when the packet was built
+};
+static_assert(sizeof(TelemetryHeader) == 36, "TelemetryHeader must have no padding");
+
+static const size_t TELEM_PREAMBLE_SIZE = sizeof(TelemetryHeader) + NUM_SENSORS * sizeof(RunScale);
+
+// Samples still in the ring: sequence numbers [first, next)
+struct SampleRange {
+  uint32_t first;
+  uint32_t next;
+  uint32_t newest_ms;    // millis() of sample next - 1
+};
+
+// Implemented in the sketch
+extern uint32_t boot_id;   // Random per boot
+extern void get_sample_range(SampleRange& r);
+extern size_t get_telemetry_record(uint32_t seq, uint8_t* out);
+
+// Plan a packet for a client that wants samples from `since` on; at most
+// max_count records
+inline void telem_begin(TelemetryHeader& h, const SampleRange& r, uint32_t since, uint16_t max_count) {
+  uint32_t first = r.first;
+  uint32_t next  = r.next;
+  h.magic       = TELEM_MAGIC;
+  h.version     = TELEM_VERSION;
+  h.num_sensors = NUM_SENSORS;
+  h.sample_ms   = SAMPLE_MS;
+  h.boot_id     = boot_id;
+  h.next_seq    = next;
+  h.flags       = 0;
+  h.dropped     = 0;
+  h.newest_ms   = r.newest_ms;
+  h.sent_ms     = millis();
+
+  uint32_t start = since;
+  if ((int32_t)(since - next) > 0) {
+    start = first;
+    h.flags |= TELEM_RESET;
+  } else if ((int32_t)(first - since) > 0) {
+    start = first;
+    h.flags |= TELEM_GAP;
+    h.dropped = first - since;
+  }
+  h.first_seq = start;
+  h.count = (uint16_t)min(next - start, (uint32_t)max_count);
+}
+
+// Header and scale table; returns TELEM_PREAMBLE_SIZE
+inline size_t telem_write_preamble(uint8_t* out, const TelemetryHeader& h) {
+  memcpy(out, &h, sizeof(h));
+  uint8_t* p = out + sizeof(h);
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    RunScale sc = { SENSOR_TOPOLOGY[i].flow_scale, SENSOR_TOPOLOGY[i].temp_scale };
+    memcpy(p, &sc, sizeof(sc));
+    p += sizeof(sc);
+  }
+  return TELEM_PREAMBLE_SIZE;
+}
\ No newline at end of file
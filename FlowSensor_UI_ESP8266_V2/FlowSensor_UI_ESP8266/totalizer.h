@@ -0,0 +1,122 @@
+#pragma once
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "sensors.h"
+
+// --- Volume totalizer ---
+// Dispensed volume per sensor, integrated from every acquisition-rate read
+// rather than from the 20 Hz or 0.5 s means. Each tick adds the raw flow
+// word times the microseconds since the previous tick to an int64 sum, so
+// the integral is exact: nothing is rounded until it is reported, and
+// small flows never vanish against a large total as they would in a float.
+// 1 mL is flow_scale * 60e6 units; int64 holds years at full scale.
+//
+// The sums are checkpointed to TOTAL_FILE, which holds TOTAL_SLOTS
+// checkpoint slots written in turn. Each carries a sequence number and a
+// CRC, and at boot the newest valid slot wins, so a reset during a write
+// costs one checkpoint interval at most and successive writes never hit
+// the same slot.
+
+#define TOTAL_FILE           "/totals.bin"
+#define TOTAL_SLOTS          8
+#define TOTAL_CHECKPOINT_MS  60000UL    // At most one slot write per minute
+#define TOTAL_MAGIC          0x544F5446UL   // "FTOT"
+
+struct TotalCheckpoint {
+  uint32_t magic;
+  uint32_t seq;                       // Checkpoint number, slot seq % TOTAL_SLOTS
+  int64_t  sum[NUM_SENSORS];          // Raw flow word x us
+  uint32_t since_unix[NUM_SENSORS];   // Last reset, 0 if the clock was not set
+  uint32_t crc;                       // CRC-32 of everything before it
+};
+
+struct Totalizer {
+  int64_t  sum[NUM_SENSORS];
+  uint32_t since_unix[NUM_SENSORS];
+  uint32_t last_tick_us;
+  bool     running;       // last_tick_us is the previous tick
+  uint32_t seq;           // Sequence number of the last checkpoint
+  bool     dirty;         // Changed since the last checkpoint
+  uint32_t checkpoints;   // Slot writes since boot
+};
+
+static Totalizer _total = {};
+
+static inline uint32_t _total_crc32(const uint8_t* p, size_t n) {
+  uint32_t crc = 0xFFFFFFFFUL;
+  while (n--) {
+    crc ^= *p++;
+    for (uint8_t b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320UL & -(crc & 1));
+  }
+  return ~crc;
+}
+
+// Restore the newest valid checkpoint; totals start from zero without one
+inline void total_begin() {
+  memset(&_total, 0, sizeof(_total));
+  File f = LittleFS.open(TOTAL_FILE, "r");
+  if (!f) return;
+  bool found = false;
+  TotalCheckpoint c;
+  while (f.read((uint8_t*)&c, sizeof(c)) == sizeof(c)) {
+    if (c.magic != TOTAL_MAGIC || c.crc != _total_crc32((const uint8_t*)&c, offsetof(TotalCheckpoint, crc))) continue;
+    if (found && (int32_t)(c.seq - _total.seq) <= 0) continue;
+    found = true;
+    _total.seq = c.seq;
+    memcpy(_total.sum, c.sum, sizeof(c.sum));
+    memcpy(_total.since_unix, c.since_unix, sizeof(c.since_unix));
+  }
+  f.close();
+}
+
+// Integrate the reads of the acquisition period that just ended. A read
+// that failed adds nothing: the volume during a dropout is unknown.
+inline void total_tick(const RawReading raw[], uint32_t now_us) {
+  uint32_t dt = _total.running ? now_us - _total.last_tick_us : 0;
+  _total.running = true;
+  _total.last_tick_us = now_us;
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    if (!sensor_enabled[i] || !raw[i].ok || raw[i].flow == 0) continue;
+    _total.sum[i] += (int64_t)raw[i].flow * dt;
+    _total.dirty = true;
+  }
+}
+
+// Total of one sensor in microlitres
+inline int64_t total_ul(uint8_t i) {
+  return llround((double)_total.sum[i] / (SENSOR_TOPOLOGY[i].flow_scale * 60000.0));
+}
+
+inline void total_reset(uint8_t i, uint32_t now_unix) {
+  _total.sum[i] = 0;
+  _total.since_unix[i] = now_unix;
+  _total.dirty = true;
+}
+
+// Write the sums to the next slot
+inline bool total_checkpoint() {
+  if (!LittleFS.exists(TOTAL_FILE)) {
+    File f = LittleFS.open(TOTAL_FILE, "w");
+    if (!f) return false;
+    TotalCheckpoint empty = {};
+    for (uint8_t s = 0; s < TOTAL_SLOTS; s++) f.write((const uint8_t*)&empty, sizeof(empty));
+    f.close();
+  }
+  TotalCheckpoint c = {};
+  c.magic = TOTAL_MAGIC;
+  c.seq   = _total.seq + 1;
+  memcpy(c.sum, _total.sum, sizeof(c.sum));
+  memcpy(c.since_unix, _total.since_unix, sizeof(c.since_unix));
+  c.crc = _total_crc32((const uint8_t*)&c, offsetof(TotalCheckpoint, crc));
+
+  File f = LittleFS.open(TOTAL_FILE, "r+");
+  if (!f) return false;
+  f.seek((c.seq % TOTAL_SLOTS) * sizeof(c), SeekSet);
+  bool ok = f.write((const uint8_t*)&c, sizeof(c)) == sizeof(c);
+  f.close();
+  if (!ok) return false;
+  _total.seq = c.seq;
+  _total.dirty = false;
+  _total.checkpoints++;
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+#include <Arduino.h>
+#include "sensors.h"
+
+// --- Trend tiers ---
+// Downsampled history in RAM beyond the 20 s sample ring. Each tier is a
+// ring of buckets holding flow min/mean/max and mean temperature as raw
+// words. Tier 0 buckets aggregate 20 Hz samples; each higher tier takes the
+// buckets closed by the tier below. A sample therefore costs one
+// accumulator update, and a closing bucket one more per tier above it.
+
+#define TREND_TIERS  4
+#define TREND_RAM_BUDGET  (8 * 1024)   // All tiers, apart from the sample ring's budget
+
+// Bucket length per tier: 1 s, 10 s, 1 min, 10 min, i.e. 1 min, 10 min,
+// 1 h and 10 h of history
+static constexpr uint32_t TREND_PERIOD_MS[TREND_TIERS] = { 1000, 10000, 60000, 600000 };
+
+static constexpr bool trend_periods_ok(int t = 1) {
+  return t == TREND_TIERS ||
+         (TREND_PERIOD_MS[t] % TREND_PERIOD_MS[t - 1] == 0 && trend_periods_ok(t + 1));
+}
+static_assert(TREND_PERIOD_MS[0] % SAMPLE_MS == 0 && trend_periods_ok(),
+              "Every trend period must be a multiple of the one below");
+
+// Inputs that make up one bucket of tier t
+static constexpr uint16_t trend_inputs(uint8_t t) {
+  return t == 0 ? TREND_PERIOD_MS[0] / SAMPLE_MS : TREND_PERIOD_MS[t] / TREND_PERIOD_MS[t - 1];
+}
+
+struct TrendPoint {
+  int16_t lo, mean, hi;   // Flow
+  int16_t temp;           // Mean temperature
+};
+
+// Buckets kept per tier: 60, or as many as fit in TREND_RAM_BUDGET with a
+// large topology (a tier also holds 12 bytes per sensor for the bucket
+// being filled, plus 12 of bookkeeping)
+static constexpr uint16_t TREND_SLOTS_FIT =
+  ((TREND_RAM_BUDGET / TREND_TIERS - 16) / NUM_SENSORS - 12) / sizeof(TrendPoint);
+static constexpr uint16_t TREND_SLOTS = TREND_SLOTS_FIT < 60 ? TREND_SLOTS_FIT : 60;
+static_assert(TREND_SLOTS >= 10, "Too many sensors for the trend tiers; raise TREND_RAM_BUDGET");
+
+struct TrendTier {
+  TrendPoint ring[TREND_SLOTS][NUM_SENSORS];
+  uint16_t   head;        // Slot the next bucket goes to
+  uint16_t   count;       // Buckets stored
+  uint32_t   closed_ms;   // millis() when the newest bucket closed
+  // Bucket being filled
+  uint16_t   n;
+  int32_t    flow[NUM_SENSORS];
+  int32_t    temp[NUM_SENSORS];
+  int16_t    lo[NUM_SENSORS];
+  int16_t    hi[NUM_SENSORS];
+};
+static_assert(TREND_TIERS * sizeof(TrendTier) <= TREND_RAM_BUDGET, "Trend tiers exceed TREND_RAM_BUDGET");
+
+// Add one input per sensor to tier t: a sample (lo = mean = hi) for tier
+// 0, otherwise a bucket the tier below just closed
+inline void trend_add(TrendTier tiers[], uint8_t t, const TrendPoint in[], uint32_t now_ms) {
+  TrendTier& tr = tiers[t];
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    if (tr.n == 0 || in[i].lo < tr.lo[i]) tr.lo[i] = in[i].lo;
+    if (tr.n == 0 || in[i].hi > tr.hi[i]) tr.hi[i] = in[i].hi;
+    tr.flow[i] = (tr.n == 0 ? 0 : tr.flow[i]) + in[i].mean;
+    tr.temp[i] = (tr.n == 0 ? 0 : tr.temp[i]) + in[i].temp;
+  }
+  if (++tr.n < trend_inputs(t)) return;
+
+  // Inputs are equally weighted, so the mean of means is the bucket mean
+  TrendPoint* out = tr.ring[tr.head];
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    out[i].lo   = tr.lo[i];
+    out[i].hi   = tr.hi[i];
+    out[i].mean = (int16_t)lroundf((float)tr.flow[i] / tr.n);
+    out[i].temp = (int16_t)lroundf((float)tr.temp[i] / tr.n);
+  }
+  tr.head = (tr.head + 1) % TREND_SLOTS;
+  if (tr.count < TREND_SLOTS) tr.count++;
+  tr.closed_ms = now_ms;
+  tr.n = 0;
+  if (t + 1 < TREND_TIERS) trend_add(tiers, t + 1, out, now_ms);
+}
+
+// Bucket k of a tier, oldest first (k < count)
+inline const TrendPoint* trend_point(const TrendTier& tr, uint16_t k) {
+  return tr.ring[(tr.head + TREND_SLOTS - tr.count + k) % TREND_SLOTS];
+}
\ No newline at end of file
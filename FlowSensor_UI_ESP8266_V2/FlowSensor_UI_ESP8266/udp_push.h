@@ -0,0 +1,73 @@
+#pragma once
+#include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
+#include "telemetry.h"
+
+// --- UDP telemetry push ---
+// Optional alternative to polling /telemetry: every UDP_BATCH samples go to
+// a collector as one datagram in the same packet format, so one host can
+// follow many nodes. The collector may be a unicast or a multicast
+// (224.0.0.0/4) address. Datagrams are not resent: the collector sees a lost
+// one as a jump in first_seq (see tools/udp_collector.py).
+
+#define UDP_BATCH          10   // Samples per datagram (0.5 s @ 20 Hz)
+#define UDP_MULTICAST_TTL  1    // Stay on the local network
+
+static const size_t UDP_PACKET_MAX = TELEM_PREAMBLE_SIZE + UDP_BATCH * TELEM_RECORD_SIZE;
+static_assert(UDP_PACKET_MAX <= 1400, "UDP datagram would be fragmented; reduce UDP_BATCH");
+
+static WiFiUDP   _udp;
+static IPAddress _udp_dest;
+static uint16_t  _udp_port = 0;        // 0 = push disabled
+static bool      _udp_multicast = false;
+static uint32_t  _udp_next_seq = 0;    // First sample not sent yet
+static uint32_t  _udp_sent = 0;
+static uint32_t  _udp_errors = 0;      // Datagrams the network stack refused
+static uint32_t  _udp_dropped = 0;     // Samples overwritten before they were sent
+
+// Push to host:port from now on; an empty or invalid host leaves it off
+inline bool udp_push_begin(const char* host, uint16_t port) {
+  if (!host[0] || !_udp_dest.fromString(host)) return false;
+  _udp_port = port;
+  _udp_multicast = _udp_dest[0] >= 224 && _udp_dest[0] <= 239;
+  SampleRange r;
+  get_sample_range(r);
+  _udp_next_seq = r.next;
+  Serial.printf("[udp] Pushing %d samples per datagram to %s:%u%s\n", UDP_BATCH,
+                _udp_dest.toString().c_str(), port, _udp_multicast ? " (multicast)" : "");
+  return true;
+}
+
+// Send one datagram once a full batch is waiting
+inline void udp_push_loop() {
+  if (!_udp_port) return;
+  SampleRange r;
+  get_sample_range(r);
+  if (r.next - _udp_next_seq < UDP_BATCH) return;
+  PERF_SCOPE(PERF_UDP);
+
+  TelemetryHeader h;
+  telem_begin(h, r, _udp_next_seq, UDP_BATCH);
+  if (h.flags & TELEM_GAP) _udp_dropped += h.dropped;
+
+  static uint8_t pkt[UDP_PACKET_MAX];
+  size_t len = telem_write_preamble(pkt, h);
+  for (uint16_t k = 0; k < h.count; k++) {
+    len += get_telemetry_record(h.first_seq + k, pkt + len);
+  }
+
+  int ok = _udp_multicast
+    ? _udp.beginPacketMulticast(_udp_dest, _udp_port, WiFi.localIP(), UDP_MULTICAST_TTL)
+    : _udp.beginPacket(_udp_dest, _udp_port);
+  if (ok) {
+    _udp.write(pkt, len);
+    ok = _udp.endPacket();
+  }
+  if (ok) {
+    _udp_sent++;
+  } else {
+    _udp_errors++;
+  }
+  // Move on either way: a retry would only delay newer samples
+  _udp_next_seq = h.first_seq + h.count;
+}
\ No newline at end of file
@@ -2,8 +2,21 @@
 #include <ESP8266WebServer.h>
 #include <uri/UriRegex.h>
 #include "sensors.h"   // bring in NUM_SENSORS + get/set_sensor_enabled + extern sensor_enabled[]
+#include "runlog.h"    // RecordMode
+#include "telemetry.h"
+#include "trend.h"
+#include "pid.h"
+#include "events.h"
+#include "totalizer.h"
+#include "udp_push.h"   // /perf counters
+#include "jsonbuf.h"
+#include "page_gz.h"   // _PAGE_INDEX gzipped by tools/gzip_page.py
 
 #define POLL_INTERVAL_MS 1000
+#define SSE_PUSH_MS      1000   // /stream event period, SAMPLE_MS or more
+#define SSE_MAX_CLIENTS  4
+#define SSE_RETRY_MS     30000  // Dashboard retries /stream while polling
+#define TREND_REFRESH_MS 10000  // Dashboard reloads the trend charts
 #define STR_HELPER(x) #x
 #define STR(x) STR_HELPER(x)
 
@@ -16,12 +29,30 @@ extern void get_ui_snapshot(
   bool s_ok[NUM_SENSORS],
   bool& is_recording, bool& is_csv_ready
 );
-extern void start_run();
+extern void start_run(RecordMode mode);
 extern void stop_run();
-extern bool stream_csv_to_client(ESP8266WebServer& server);
+extern uint32_t get_snapshot_id();
+extern uint32_t get_samples_lost();
+extern const TrendTier& get_trend(uint8_t tier);
+extern void get_pulsation(float hz[], float amp[]);
+extern void get_run_stats(uint8_t& mode, uint32_t& bytes_per_s, uint32_t& dropped, float& compression);
+extern bool get_run_entry(uint32_t id, RunIndexEntry& e);
+extern uint32_t get_next_run_id();
+extern bool stream_csv_to_client(ESP8266WebServer& server, uint32_t id);
+extern bool stream_history_to_client(ESP8266WebServer& server, uint32_t id,
+                                     uint32_t from_ms, uint32_t to_ms, uint16_t points);
+extern bool get_event_entry(uint32_t id, EventEntry& e);
+extern uint32_t get_next_event_id();
+extern const EventTrigger& get_event_trigger(uint8_t sensor);
+extern void set_event_trigger(uint8_t sensor, const EventTrigger& tr);
+extern void get_event_stats(uint32_t& missed, uint32_t& skipped);
+extern bool stream_event_csv_to_client(ESP8266WebServer& server, uint32_t id);
+extern void reset_total(uint8_t sensor);
 
 // HTML Dashboard with 4 sensors, brown glassmorphism theme
-static const char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
+// This is the page source: it is served from page_gz.h, generated from it
+// by tools/gzip_page.py, so rerun that script after editing the page.
+static constexpr char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
 <html lang="en">
 <head>
     <meta charset="UTF-8">
@@ -157,6 +188,13 @@ static const char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
             background: rgba(255, 255, 255, 0.05);
         }
 
+        .trend {
+            display: block;
+            width: 100%;
+            height: 60px;
+            margin-top: 15px;
+        }
+
         .controls {
             background: rgba(121, 85, 72, 0.25);
             backdrop-filter: blur(12px);
@@ -264,6 +302,15 @@ static const char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
             color: #ffccbc;
         }
 
+        select.info-value {
+            background: transparent;
+            border: none;
+        }
+
+        select.info-value option {
+            background: #5d4037;
+        }
+
         .footer {
             text-align: center;
             margin-top: 30px;
@@ -295,123 +342,8 @@ static const char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
     <div class="container">
         <h1>Flow Sensors Dashboard</h1>
         
-        <div class="sensors-grid">
-            <!-- Sensor 1 -->
-            <div class="sensor-card" id="sensor1">
-                <div class="sensor-header">
-                    <span class="sensor-title">SENSOR 1</span>
-                </div>
-                <div class="sensor-info">
-                    <span class="info-badge">Temp: <span id="temp1">--</span> °C</span>
-                    <span class="info-badge">Status: <span class="status-ok" id="status1">OK</span></span>
-                </div>
-                <div class="metrics">
-                    <div class="metric-row">
-                        <span class="metric-label">Mean(mL/min): </span><span id="mean1">--</span>
-                    </div>
-                    <div class="metric-row">
-                        <span class="metric-label">RMS(mL/min): </span><span id="rms1">--</span>
-                    </div>
-                </div>
-                <table class="data-table">
-                    <thead>
-                        <tr>
-                            <th>Number</th>
-                            <th>Flow (mL/min)</th>
-                            <th>Temp (°C)</th>
-                        </tr>
-                    </thead>
-                    <tbody id="data1"></tbody>
-                </table>
-            </div>
-
-            <!-- Sensor 2 -->
-            <div class="sensor-card" id="sensor2">
-                <div class="sensor-header">
-                    <span class="sensor-title">SENSOR 2</span>
-                </div>
-                <div class="sensor-info">
-                    <span class="info-badge">Temp: <span id="temp2">--</span> °C</span>
-                    <span class="info-badge">Status: <span class="status-ok" id="status2">OK</span></span>
-                </div>
-                <div class="metrics">
-                    <div class="metric-row">
-                        <span class="metric-label">Mean(mL/min): </span><span id="mean2">--</span>
-                    </div>
-                    <div class="metric-row">
-                        <span class="metric-label">RMS(mL/min): </span><span id="rms2">--</span>
-                    </div>
-                </div>
-                <table class="data-table">
-                    <thead>
-                        <tr>
-                            <th>Number</th>
-                            <th>Flow (mL/min)</th>
-                            <th>Temp (°C)</th>
-                        </tr>
-                    </thead>
-                    <tbody id="data2"></tbody>
-                </table>
-            </div>
-
-            <!-- Sensor 3 -->
-            <div class="sensor-card" id="sensor3">
-                <div class="sensor-header">
-                    <span class="sensor-title">SENSOR 3</span>
-                </div>
-                <div class="sensor-info">
-                    <span class="info-badge">Temp: <span id="temp3">--</span> °C</span>
-                    <span class="info-badge">Status: <span class="status-ok" id="status3">OK</span></span>
-                </div>
-                <div class="metrics">
-                    <div class="metric-row">
-                        <span class="metric-label">Mean(mL/min): </span><span id="mean3">--</span>
-                    </div>
-                    <div class="metric-row">
-                        <span class="metric-label">RMS(mL/min): </span><span id="rms3">--</span>
-                    </div>
-                </div>
-                <table class="data-table">
-                    <thead>
-                        <tr>
-                            <th>Number</th>
-                            <th>Flow (mL/min)</th>
-                            <th>Temp (°C)</th>
-                        </tr>
-                    </thead>
-                    <tbody id="data3"></tbody>
-                </table>
-            </div>
-
-            <!-- Sensor 4 -->
-            <div class="sensor-card" id="sensor4">
-                <div class="sensor-header">
-                    <span class="sensor-title">SENSOR 4</span>
-                </div>
-                <div class="sensor-info">
-                    <span class="info-badge">Temp: <span id="temp4">--</span> °C</span>
-                    <span class="info-badge">Status: <span class="status-ok" id="status4">OK</span></span>
-                </div>
-                <div class="metrics">
-                    <div class="metric-row">
-                        <span class="metric-label">Mean(mL/min): </span><span id="mean4">--</span>
-                    </div>
-                    <div class="metric-row">
-                        <span class="metric-label">RMS(mL/min): </span><span id="rms4">--</span>
-                    </div>
-                </div>
-                <table class="data-table">
-                    <thead>
-                        <tr>
-                            <th>Number</th>
-                            <th>Flow (mL/min)</th>
-                            <th>Temp (°C)</th>
-                        </tr>
-                    </thead>
-                    <tbody id="data4"></tbody>
-                </table>
-            </div>
-        </div>
+        <!-- One card per sensor, built from the first /api response -->
+        <div class="sensors-grid" id="sensorsGrid"></div>
 
         <div class="controls">
             <h2 class="controls-header">CONTROLS</h2>
@@ -419,11 +351,12 @@ static const char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
                 <button class="btn btn-start" id="btnStart" onclick="startMonitoring()">Start</button>
                 <button class="btn btn-stop" id="btnStop" onclick="stopMonitoring()" disabled>Stop</button>
                 <a class="btn btn-download" id="btnDownload" href="/log.csv" style="display:none;">Download CSV</a>
+                <label class="info-label" style="align-self:center;"><input type="checkbox" id="fullRate"> Full rate (20 Hz)</label>
             </div>
             <div class="control-info">
                 <div class="info-item">
-                    <div class="info-label">Auto poll</div>
-                    <div class="info-value" id="autopoll">on</div>
+                    <div class="info-label">Updates</div>
+                    <div class="info-value" id="autopoll">poll</div>
                 </div>
                 <div class="info-item">
                     <div class="info-label">Last update</div>
@@ -433,6 +366,19 @@ static const char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
                     <div class="info-label">Interval</div>
                     <div class="info-value" id="interval">)HTML" STR(POLL_INTERVAL_MS) R"HTML( ms</div>
                 </div>
+                <div class="info-item">
+                    <div class="info-label">Recording</div>
+                    <div class="info-value" id="recstats">--</div>
+                </div>
+                <div class="info-item">
+                    <div class="info-label">Trend</div>
+                    <select class="info-value" id="trendTier" onchange="trendTier = +this.value; loadTrend()">
+                        <option value="0">1 min</option>
+                        <option value="1">10 min</option>
+                        <option value="2">1 h</option>
+                        <option value="3">10 h</option>
+                    </select>
+                </div>
             </div>
         </div>
 
@@ -442,22 +388,21 @@ static const char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
     </div>
 
     <script>
-        const NUM_SENSORS = 4;
         const MAX_ROWS = 10;
-        let sensorData = [[], [], [], []];
+        let sensorData = [];
         let updateInterval;
+        let stream;
         let metricsTick = 0;
+        let trendTier = 0;
+        let backfilled = false;
 
         function startMonitoring() {
-            fetch('/start', { method: 'POST' })
+            const mode = document.getElementById('fullRate').checked ? 'raw' : 'avg';
+            fetch('/start?mode=' + mode, { method: 'POST' })
                 .then(() => {
-                    document.getElementById('autopoll').textContent = 'on';
                     document.getElementById('btnStart').disabled = true;
                     document.getElementById('btnStop').disabled = false;
                     document.getElementById('btnDownload').style.display = 'none';
-                    if (!updateInterval) {
-                        updateInterval = setInterval(updateData, )HTML" STR(POLL_INTERVAL_MS) R"HTML();
-                    }
                     updateData();
                 })
                 .catch(e => console.error('Start error:', e));
@@ -473,109 +418,435 @@ static const char _PAGE_INDEX[] PROGMEM = R"HTML(<!DOCTYPE html>
                 .catch(e => console.error('Stop error:', e));
         }
 
-        function updateData() {
-            fetch('/api', { cache: 'no-store' })
-                .then(response => response.json())
-                .then(data => {
-                    document.getElementById('lastupdate').textContent = new Date().toLocaleTimeString();
-                    
-                    // Update download button visibility
-                    const dlBtn = document.getElementById('btnDownload');
-                    if (data.run && data.run.csv_ready) {
-                        dlBtn.style.display = 'inline-block';
-                    } else {
-                        dlBtn.style.display = 'none';
-                    }
+        function createCard(i) {
+            const card = document.createElement('div');
+            card.className = 'sensor-card';
+            card.id = 'sensor' + i;
+            card.innerHTML =
+                '<div class="sensor-header"><span class="sensor-title">SENSOR ' + i + '</span></div>' +
+                '<div class="sensor-info">' +
+                    '<span class="info-badge">Temp: <span id="temp' + i + '">--</span> °C</span>' +
+                    '<span class="info-badge">Status: <span class="status-ok" id="status' + i + '">OK</span></span>' +
+                '</div>' +
+                '<div class="metrics">' +
+                    '<div class="metric-row"><span class="metric-label">Mean(mL/min): </span><span id="mean' + i + '">--</span></div>' +
+                    '<div class="metric-row"><span class="metric-label">RMS(mL/min): </span><span id="rms' + i + '">--</span></div>' +
+                    '<div class="metric-row"><span class="metric-label">Pulsation: </span><span id="pulse' + i + '">--</span></div>' +
+                    '<div class="metric-row"><span class="metric-label">Total(mL): </span><span id="total' + i + '">--</span></div>' +
+                '</div>' +
+                '<canvas class="trend" id="trend' + i + '" width="300" height="60"></canvas>' +
+                '<table class="data-table"><thead><tr><th>Number</th><th>Flow (mL/min)</th><th>Temp (°C)</th></tr></thead>' +
+                '<tbody id="data' + i + '"></tbody></table>';
+            document.getElementById('sensorsGrid').appendChild(card);
+            sensorData.push([]);
+        }
 
-                    // Update all sensors
-                    for (let i = 1; i <= NUM_SENSORS; i++) {
-                        const sensor = data['s' + i];
-                        if (!sensor) continue;
+        function renderRows(i) {
+            const tbody = document.getElementById('data' + i);
+            tbody.innerHTML = sensorData[i-1].map((row, idx) => 
+                '<tr><td>' + (idx + 1) + '</td><td>' + 
+                row.flow.toFixed(2) + '</td><td>' + 
+                row.temp.toFixed(2) + '</td></tr>'
+            ).join('');
+        }
 
-                        const card = document.getElementById('sensor' + i);
-                        const statusEl = document.getElementById('status' + i);
+        function render(data) {
+            document.getElementById('lastupdate').textContent = new Date().toLocaleTimeString();
+            
+            // Update download button visibility
+            const dlBtn = document.getElementById('btnDownload');
+            if (data.run && data.run.csv_ready) {
+                dlBtn.style.display = 'inline-block';
+            } else {
+                dlBtn.style.display = 'none';
+            }
+            if (data.run && data.run.recording) {
+                document.getElementById('recstats').textContent =
+                    data.run.mode + ', ' + data.run.write_bps + ' B/s, ' + data.run.dropped + ' dropped';
+            }
 
-                        // Status
-                        statusEl.textContent = sensor.ok ? 'OK' : 'ERROR';
-                        statusEl.className = sensor.ok ? 'status-ok' : 'status-error';
+            // Update all sensors (s1..sN), adding cards the first time
+            for (let i = 1; data['s' + i]; i++) {
+                const sensor = data['s' + i];
+                if (i > sensorData.length) createCard(i);
+
+                const card = document.getElementById('sensor' + i);
+                const statusEl = document.getElementById('status' + i);
+
+                // Status
+                statusEl.textContent = sensor.ok ? 'OK' : 'ERROR';
+                statusEl.className = sensor.ok ? 'status-ok' : 'status-error';
+
+                // Temperature
+                document.getElementById('temp' + i).textContent = sensor.temp_1s.toFixed(2);
+
+                // Rolling data table
+                sensorData[i-1].unshift({
+                    flow: sensor.flow_1s,
+                    temp: sensor.temp_1s
+                });
+                if (sensorData[i-1].length > MAX_ROWS) {
+                    sensorData[i-1].pop();
+                }
+
+                renderRows(i);
+                document.getElementById('total' + i).textContent = sensor.total_ml.toFixed(1);
+
+                // Update metrics every 10 updates
+                if (metricsTick === 0) {
+                    document.getElementById('mean' + i).textContent = sensor.mean10.toFixed(2);
+                    document.getElementById('rms' + i).textContent = sensor.rms10.toFixed(2);
+                    document.getElementById('pulse' + i).textContent = sensor.pulse_hz > 0 ?
+                        sensor.pulse_hz.toFixed(2) + ' Hz, ±' + sensor.pulse_amp.toFixed(2) + ' mL/min' : '--';
+                }
+            }
 
-                        // Temperature
-                        document.getElementById('temp' + i).textContent = sensor.temp_1s.toFixed(2);
+            metricsTick = (metricsTick + 1) % 10;
+        }
 
-                        // Rolling data table
-                        sensorData[i-1].unshift({
-                            flow: sensor.flow_1s,
-                            temp: sensor.temp_1s
-                        });
-                        if (sensorData[i-1].length > MAX_ROWS) {
-                            sensorData[i-1].pop();
-                        }
+        // Flow trend of one sensor: min..max band with the mean line on top
+        function drawTrend(i, s) {
+            const c = document.getElementById('trend' + i);
+            const ctx = c.getContext('2d');
+            const w = c.width, h = c.height, n = s.mean.length;
+            ctx.clearRect(0, 0, w, h);
+            if (n < 2) return;
+            const lo = Math.min(...s.min), span = (Math.max(...s.max) - lo) || 1;
+            const x = k => k * (w - 1) / (n - 1);
+            const y = v => h - 2 - (v - lo) / span * (h - 4);
+            ctx.fillStyle = 'rgba(255, 204, 188, 0.25)';
+            ctx.beginPath();
+            s.max.forEach((v, k) => ctx.lineTo(x(k), y(v)));
+            for (let k = n - 1; k >= 0; k--) ctx.lineTo(x(k), y(s.min[k]));
+            ctx.fill();
+            ctx.strokeStyle = '#ffccbc';
+            ctx.beginPath();
+            s.mean.forEach((v, k) => ctx.lineTo(x(k), y(v)));
+            ctx.stroke();
+        }
 
-                        const tbody = document.getElementById('data' + i);
-                        tbody.innerHTML = sensorData[i-1].map((row, idx) => 
-                            '<tr><td>' + (idx + 1) + '</td><td>' + 
-                            row.flow.toFixed(2) + '</td><td>' + 
-                            row.temp.toFixed(2) + '</td></tr>'
-                        ).join('');
-
-                        // Update metrics every 10 polls
-                        if (metricsTick === 0) {
-                            document.getElementById('mean' + i).textContent = sensor.mean10.toFixed(2);
-                            document.getElementById('rms' + i).textContent = sensor.rms10.toFixed(2);
+        // Trend charts from /trend; the first 1 s tier also backfills the tables
+        function loadTrend() {
+            fetch('/trend?tier=' + trendTier, { cache: 'no-cache' })
+                .then(response => response.json())
+                .then(data => {
+                    for (let i = 1; data['s' + i]; i++) {
+                        const s = data['s' + i];
+                        if (i > sensorData.length) createCard(i);
+                        if (!backfilled && data.tier === 0) {
+                            const n = s.mean.length;
+                            sensorData[i-1] = s.mean.slice(-MAX_ROWS).reverse().map((flow, k) =>
+                                ({ flow: flow, temp: s.temp[n - 1 - k] }));
+                            renderRows(i);
                         }
+                        drawTrend(i, s);
                     }
-
-                    metricsTick = (metricsTick + 1) % 10;
+                    backfilled = backfilled || data.tier === 0;
                 })
+                .catch(e => console.error('Trend error:', e));
+        }
+
+        function updateData() {
+            fetch('/api', { cache: 'no-cache' })
+                .then(response => response.json())
+                .then(render)
                 .catch(e => console.error('Update error:', e));
         }
 
-        // Start passive polling on page load (no recording until START is pressed)
+        function startPolling() {
+            if (!updateInterval) {
+                updateInterval = setInterval(updateData, )HTML" STR(POLL_INTERVAL_MS) R"HTML();
+            }
+            document.getElementById('autopoll').textContent = 'poll';
+            document.getElementById('interval').textContent = ')HTML" STR(POLL_INTERVAL_MS) R"HTML( ms';
+        }
+
+        // Snapshots pushed over /stream; poll /api while it is unavailable
+        function startStream() {
+            if (!window.EventSource) {
+                startPolling();
+                return;
+            }
+            stream = new EventSource('/stream');
+            stream.onopen = () => {
+                clearInterval(updateInterval);
+                updateInterval = null;
+                document.getElementById('autopoll').textContent = 'stream';
+                document.getElementById('interval').textContent = ')HTML" STR(SSE_PUSH_MS) R"HTML( ms';
+            };
+            stream.onmessage = e => render(JSON.parse(e.data));
+            stream.onerror = () => {
+                stream.close();
+                startPolling();
+                setTimeout(startStream, )HTML" STR(SSE_RETRY_MS) R"HTML();
+            };
+        }
+
+        // Start passive updates on page load (no recording until START is pressed)
         window.addEventListener('DOMContentLoaded', () => {
             updateData();
-            updateInterval = setInterval(updateData, )HTML" STR(POLL_INTERVAL_MS) R"HTML();
+            startStream();
+            loadTrend();
+            setInterval(loadTrend, )HTML" STR(TREND_REFRESH_MS) R"HTML();
         });
     </script>
 </body>
 </html>)HTML";
 
+// FNV-1a over the page source, checked against the hash recorded in page_gz.h
+static constexpr uint32_t _page_hash(const char* s, size_t n) {
+    uint32_t h = 0x811C9DC5UL;
+    for (size_t i = 0; i < n; i++) h = (h ^ (uint8_t)s[i]) * 0x01000193UL;
+    return h;
+}
+
+static_assert(sizeof(_PAGE_INDEX) - 1 == PAGE_INDEX_SRC_LEN &&
+              _page_hash(_PAGE_INDEX, sizeof(_PAGE_INDEX) - 1) == PAGE_INDEX_SRC_HASH,
+              "page_gz.h is stale: run tools/gzip_page.py");
+
+#define PAGE_CACHE_CONTROL  "max-age=86400"   // Revalidated with the ETag after a day
+
 // HTTP Handler Functions
 static void _handle_root() { 
-    _server.send_P(200, "text/html", _PAGE_INDEX); 
+    if (_server.header("If-None-Match") == PAGE_INDEX_ETAG) {
+        _server.send(304);
+        return;
+    }
+    _server.sendHeader("Content-Encoding", "gzip");
+    _server.sendHeader("Cache-Control", PAGE_CACHE_CONTROL);
+    _server.sendHeader("ETag", PAGE_INDEX_ETAG);
+    _server.send_P(200, "text/html", (PGM_P)_PAGE_INDEX_GZ, sizeof(_PAGE_INDEX_GZ));
 }
 
-static void _handle_api() {
+// Upper bound of one "sN":{...} object and of the whole /api response
+#define API_SENSOR_JSON_MAX  220
+#define API_JSON_MAX         (NUM_SENSORS * API_SENSOR_JSON_MAX + 160)
+
+// Serialised snapshot shared by /api and /stream. It is rebuilt only when
+// get_snapshot_id() (or a sensor toggle) says the content changed, i.e. at
+// most once per 20 Hz sample however many clients ask. The JSON starts
+// after room for the "data: " prefix of a /stream event and leaves room
+// for its "\n\n" terminator.
+#define SSE_PREFIX       "data: "
+#define SSE_PREFIX_LEN   6
+static char _api_buf[SSE_PREFIX_LEN + API_JSON_MAX + 2];
+static size_t   _api_len = 0;
+static uint32_t _api_id = 0;          // Snapshot id of the cached JSON
+static uint32_t _api_toggles = 0;     // Sensor toggles through the web UI
+static uint32_t _api_rebuilds = 0;
+static uint32_t _api_not_modified = 0;
+
+// Serialise the live snapshot into out; returns the length, 0 if it did not fit
+static size_t _api_json(char* out, size_t cap) {
     float f_1s[NUM_SENSORS], t_1s[NUM_SENSORS];
     float m10[NUM_SENSORS], r10[NUM_SENSORS], cv10[NUM_SENSORS];
+    float p_hz[NUM_SENSORS], p_amp[NUM_SENSORS];
     bool ok[NUM_SENSORS];
     bool rec, csv;
     
     get_ui_snapshot(f_1s, t_1s, m10, r10, cv10, ok, rec, csv);
+    get_pulsation(p_hz, p_amp);
 
-    String json = "{";
+    JsonBuf j(out, cap);
+    j.ch('{');
     for (int i = 0; i < NUM_SENSORS; i++) {
-        json += "\"s" + String(i + 1) + "\":{";
-        json += "\"flow_1s\":" + String(f_1s[i], 3) + ",";
-        json += "\"temp_1s\":" + String(t_1s[i], 3) + ",";
-        json += "\"mean10\":" + String(m10[i], 3) + ",";
-        json += "\"rms10\":" + String(r10[i], 3) + ",";
-        json += "\"cv10\":" + String(cv10[i], 2) + ",";
-        json += "\"ok\":" + String(ok[i] ? "true" : "false") + ",";
-        json += "\"enabled\":" + String(get_sensor_enabled((uint8_t)(i + 1)) ? "true" : "false");
-        json += "}";
-        if (i < NUM_SENSORS - 1) json += ",";
+        j.raw("\"s");
+        j.u32(i + 1);
+        j.raw("\":{");
+        j.key("flow_1s");  j.fixed(f_1s[i], 3);  j.ch(',');
+        j.key("temp_1s");  j.fixed(t_1s[i], 3);  j.ch(',');
+        j.key("mean10");   j.fixed(m10[i], 3);   j.ch(',');
+        j.key("rms10");    j.fixed(r10[i], 3);   j.ch(',');
+        j.key("cv10");     j.fixed(cv10[i], 2);  j.ch(',');
+        j.key("pulse_hz"); j.fixed(p_hz[i], 2);  j.ch(',');
+        j.key("pulse_amp"); j.fixed(p_amp[i], 3); j.ch(',');
+        j.key("total_ml"); j.scaled(total_ul(i), 3); j.ch(',');
+        j.key("ok");       j.boolean(ok[i]);     j.ch(',');
+        j.key("enabled");  j.boolean(get_sensor_enabled((uint8_t)(i + 1)));
+        j.ch('}');
+        if (i < NUM_SENSORS - 1) j.ch(',');
     }
-    
-    json += ",\"run\":{";
-    json += "\"recording\":" + String(rec ? "true" : "false") + ",";
-    json += "\"csv_ready\":" + String(csv ? "true" : "false");
-    json += "}}";
-    
-    _server.send(200, "application/json", json);
+
+    uint8_t mode;
+    uint32_t bps, dropped;
+    float ratio;
+    get_run_stats(mode, bps, dropped, ratio);
+
+    j.raw(",\"run\":{");
+    j.key("recording");   j.boolean(rec);   j.ch(',');
+    j.key("csv_ready");   j.boolean(csv);   j.ch(',');
+    j.key("mode");        j.str(mode == RECORD_RAW ? "raw" : "avg");  j.ch(',');
+    j.key("write_bps");   j.u32(bps);       j.ch(',');
+    j.key("dropped");     j.u32(dropped);   j.ch(',');
+    j.key("compression"); j.fixed(ratio, 2);
+    j.raw("}}");
+    return j.overflow ? 0 : j.len;
+}
+
+// Cached snapshot JSON (at _api_buf + SSE_PREFIX_LEN), rebuilt if stale
+static size_t _api_snapshot() {
+    uint32_t id = get_snapshot_id() + _api_toggles;
+    if (_api_len == 0 || id != _api_id) {
+        _api_len = _api_json(_api_buf + SSE_PREFIX_LEN, API_JSON_MAX);
+        _api_id = id;
+        _api_rebuilds++;
+    }
+    return _api_len;
+}
+
+static void _handle_api() {
+    PERF_SCOPE(PERF_API);
+    size_t len = _api_snapshot();
+    if (len == 0) {
+        _server.send(500, "text/plain", "Snapshot too large");
+        return;
+    }
+
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"%08x\"", _api_id ^ boot_id);
+    if (_server.header("If-None-Match") == etag) {
+        _api_not_modified++;
+        _server.send(304);
+        return;
+    }
+    _server.sendHeader("ETag", etag);
+    _server.sendHeader("Cache-Control", "no-cache");
+    _server.send(200, "application/json", _api_buf + SSE_PREFIX_LEN, len);
+}
+
+// Server-Sent Events: /stream clients get the /api snapshot every
+// SSE_PUSH_MS over their kept-alive connection
+static WiFiClient _sse_clients[SSE_MAX_CLIENTS];
+static unsigned long _sse_last_push_ms = 0;
+static uint32_t _sse_skipped = 0;   // Events not sent: client's TCP buffer was full
+
+static const char _SSE_HEADERS[] PROGMEM =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Access-Control-Allow-Origin: *\r\n\r\n";
+
+// As in the ESP8266WebServer ServerSentEvents example, the connection is
+// taken over from the server and written to directly from then on
+static void _handle_stream() {
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        if (_sse_clients[i].connected()) continue;
+        WiFiClient client = _server.client();
+        client.setNoDelay(true);
+        client.write_P(_SSE_HEADERS, sizeof(_SSE_HEADERS) - 1);
+        _sse_clients[i] = client;
+        _sse_last_push_ms = millis() - SSE_PUSH_MS;   // First event right away
+        return;
+    }
+    _server.send(503, "text/plain", "Too many stream clients");
+}
+
+static int _sse_client_count() {
+    int n = 0;
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        if (_sse_clients[i].connected()) n++;
+    }
+    return n;
+}
+
+// Push one event to every stream client. An event is only written to a
+// client whose TCP buffer can take all of it, so a slow client loses
+// events instead of holding up the loop (and with it sample_20hz()).
+static void _sse_loop() {
+    unsigned long now = millis();
+    if (now - _sse_last_push_ms < SSE_PUSH_MS) return;
+    _sse_last_push_ms = now;
+
+    bool any = false;
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        if (_sse_clients[i].connected()) {
+            any = true;
+        } else {
+            _sse_clients[i].stop();   // Release a closed connection
+        }
+    }
+    if (!any) return;
+
+    PERF_SCOPE(PERF_SSE);
+    size_t len = _api_snapshot();
+    if (len == 0) return;
+    memcpy(_api_buf, SSE_PREFIX, SSE_PREFIX_LEN);
+    len += SSE_PREFIX_LEN;
+    _api_buf[len++] = '\n';
+    _api_buf[len++] = '\n';
+
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        WiFiClient& c = _sse_clients[i];
+        if (!c.connected()) continue;
+        if (c.availableForWrite() < len) {
+            _sse_skipped++;
+            continue;
+        }
+        c.write((const uint8_t*)_api_buf, len);
+    }
+}
+
+// Profiling summary of the last completed window (see perf.h)
+static void _handle_perf() {
+    _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server.send(200, "application/json", "");
+
+    uint32_t events_missed, events_skipped;
+    get_event_stats(events_missed, events_skipped);
+
+    static char out[1024];
+    JsonBuf j(out, sizeof(out));
+    j.ch('{');
+    j.key("window_ms");          j.u32(perf_last_window_ms);     j.ch(',');
+    j.key("overruns");           j.u32(perf_last_overruns);      j.ch(',');
+    j.key("acq_skipped");        j.u32(_acq.skipped);            j.ch(',');
+    j.key("samples_lost");       j.u32(get_samples_lost());      j.ch(',');
+    j.key("bus_util_pct");       j.fixed(_acq.bus_util_pct, 1);  j.ch(',');
+    j.key("bus_util_max_pct");   j.fixed(_acq.bus_util_max_pct, 1); j.ch(',');
+    j.key("mux_selects_saved");  j.u32(_acq.selects_saved);      j.ch(',');
+    j.key("sse_clients");        j.u32(_sse_client_count());     j.ch(',');
+    j.key("sse_skipped");        j.u32(_sse_skipped);            j.ch(',');
+    j.key("api_rebuilds");       j.u32(_api_rebuilds);           j.ch(',');
+    j.key("api_not_modified");   j.u32(_api_not_modified);       j.ch(',');
+    j.key("udp_sent");           j.u32(_udp_sent);               j.ch(',');
+    j.key("udp_errors");         j.u32(_udp_errors);             j.ch(',');
+    j.key("udp_dropped");        j.u32(_udp_dropped);            j.ch(',');
+    j.key("pid_updates");        j.u32(_pid_timing.updates);     j.ch(',');
+    j.key("pid_latency_avg_us"); j.u32(_pid_timing.updates ? (uint32_t)(_pid_timing.latency_sum_us / _pid_timing.updates) : 0); j.ch(',');
+    j.key("pid_latency_max_us"); j.u32(_pid_timing.latency_max_us); j.ch(',');
+    j.key("pid_filter_delay_us"); j.u32(CIC_DELAY_US);            j.ch(',');
+    j.key("pid_jitter_avg_us");  j.u32(_pid_timing.periods ? (uint32_t)(_pid_timing.jitter_sum_us / _pid_timing.periods) : 0); j.ch(',');
+    j.key("pid_jitter_max_us");  j.u32(_pid_timing.jitter_max_us);  j.ch(',');
+    j.key("total_checkpoints");  j.u32(_total.checkpoints);      j.ch(',');
+    j.key("events_missed");      j.u32(events_missed);           j.ch(',');
+    j.key("events_skipped");     j.u32(events_skipped);          j.ch(',');
+    j.key("heap_free");          j.u32(ESP.getFreeHeap());       j.ch(',');
+    j.key("heap_max_block");     j.u32(ESP.getMaxFreeBlockSize()); j.ch(',');
+    j.key("heap_frag_pct");      j.u32(ESP.getHeapFragmentation()); j.ch(',');
+    j.raw("\"sections\":{");
+    for (int i = 0; i < PERF_COUNT; i++) {
+        // One section is under 120 chars
+        if (j.len + 120 > sizeof(out)) {
+            _server.sendContent(out, j.len);
+            j.len = 0;
+        }
+        const PerfStat& p = perf_last[i];
+        if (i) j.ch(',');
+        j.key(PERF_NAMES[i]);
+        j.ch('{');
+        j.key("calls");       j.u32(p.calls);                              j.ch(',');
+        j.key("avg_us");      j.u32(p.calls ? p.total_us / p.calls : 0);   j.ch(',');
+        j.key("max_us");      j.u32(p.max_us);                             j.ch(',');
+        j.key("ms_per_hour"); j.fixed((float)p.total_us / perf_last_window_ms * 3600.0f, 1);
+        j.ch('}');
+    }
+    j.raw("}}");
+    _server.sendContent(out, j.len);
 }
 
 static void _handle_start() { 
-    start_run(); 
+    start_run(_server.arg("mode") == "raw" ? RECORD_RAW : RECORD_AVG); 
     _server.send(200, "text/plain", "started"); 
 }
 
@@ -585,11 +856,278 @@ static void _handle_stop() {
 }
 
 static void _handle_log() {
-    if (!stream_csv_to_client(_server)) {
+    if (!stream_csv_to_client(_server, 0)) {
         _server.send(404, "text/plain", "No CSV data available. Record data first.");
     }
 }
 
+// One trend tier (see trend.h), oldest bucket first, for the dashboard
+// charts: /trend?tier=<0..3>
+//   {"tier":0,"period_ms":1000,"age_ms":420,
+//    "s1":{"min":[...],"mean":[...],"max":[...],"temp":[...]},...}
+// age_ms is the time since the newest bucket closed.
+static void _handle_trend() {
+    long tier = _server.hasArg("tier") ? _server.arg("tier").toInt() : 0;
+    if (tier < 0 || tier >= TREND_TIERS) {
+        _server.send(400, "text/plain", "tier must be below " STR(TREND_TIERS));
+        return;
+    }
+    const TrendTier& tr = get_trend((uint8_t)tier);
+    _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server.sendHeader("Cache-Control", "no-cache");
+    _server.send(200, "application/json", "");
+
+    static char out[1024];
+    JsonBuf j(out, sizeof(out));
+    j.raw("{\"tier\":");
+    j.u32(tier);
+    j.raw(",\"period_ms\":");
+    j.u32(TREND_PERIOD_MS[tier]);
+    j.raw(",\"age_ms\":");
+    j.u32(tr.count ? millis() - tr.closed_ms : 0);
+
+    static const char* const SERIES[] = { "min", "mean", "max", "temp" };
+    for (int i = 0; i < NUM_SENSORS; i++) {
+        j.raw(",\"s");
+        j.u32(i + 1);
+        j.raw("\":{");
+        for (int s = 0; s < 4; s++) {
+            if (s) j.ch(',');
+            j.key(SERIES[s]);
+            j.ch('[');
+            for (uint16_t k = 0; k < tr.count; k++) {
+                if (j.len + 16 > sizeof(out)) {
+                    _server.sendContent(out, j.len);
+                    j.len = 0;
+                }
+                if (k) j.ch(',');
+                const TrendPoint& p = trend_point(tr, k)[i];
+                switch (s) {
+                    case 0: j.fixed(flow_from_raw(i, p.lo), 3); break;
+                    case 1: j.fixed(flow_from_raw(i, p.mean), 3); break;
+                    case 2: j.fixed(flow_from_raw(i, p.hi), 3); break;
+                    default: j.fixed(temp_from_raw(i, p.temp), 2); break;
+                }
+            }
+            j.ch(']');
+        }
+        j.ch('}');
+    }
+    j.ch('}');
+    _server.sendContent(out, j.len);
+}
+
+// Downsampled history of a finished run for charting:
+// /history?run=<id>&from=<ms>&to=<ms>&points=<n>, all optional (latest run,
+// whole run, HISTORY_POINTS buckets)
+#define HISTORY_POINTS      200
+#define HISTORY_POINTS_MAX  1000
+static void _handle_history() {
+    uint32_t id      = _server.hasArg("run")  ? (uint32_t)_server.arg("run").toInt()  : 0;
+    uint32_t from_ms = _server.hasArg("from") ? (uint32_t)_server.arg("from").toInt() : 0;
+    uint32_t to_ms   = _server.hasArg("to")   ? (uint32_t)_server.arg("to").toInt()   : UINT32_MAX;
+    long points      = _server.hasArg("points") ? _server.arg("points").toInt() : HISTORY_POINTS;
+    if (to_ms < from_ms || points < 1 || points > HISTORY_POINTS_MAX) {
+        _server.send(400, "text/plain", "Need from <= to and 1 <= points <= " STR(HISTORY_POINTS_MAX));
+        return;
+    }
+    if (!stream_history_to_client(_server, id, from_ms, to_ms, (uint16_t)points)) {
+        _server.send(404, "text/plain", "No such run");
+    }
+}
+
+// Upper bound of one run object in /runs
+#define RUN_JSON_MAX  (160 + 3 * NUM_SENSORS)
+
+// Runs still on flash, oldest first, straight from the run index
+static void _handle_runs() {
+    uint32_t next = get_next_run_id();
+    uint32_t first = (next > RUN_INDEX_SLOTS) ? next - RUN_INDEX_SLOTS : 1;
+    _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server.send(200, "application/json", "");
+
+    static char out[1024];
+    JsonBuf j(out, sizeof(out));
+    j.ch('[');
+    bool any = false;
+    for (uint32_t id = first; id < next; id++) {
+        RunIndexEntry e;
+        if (!get_run_entry(id, e)) continue;
+        if (j.len + RUN_JSON_MAX > sizeof(out)) {
+            _server.sendContent(out, j.len);
+            j.len = 0;
+        }
+        if (any) j.ch(',');
+        any = true;
+        j.ch('{');
+        j.key("id");          j.u32(e.id);                                  j.ch(',');
+        j.key("start");       j.u32(e.start_unix);                          j.ch(',');
+        j.key("duration_ms"); j.u32(e.duration_ms);                         j.ch(',');
+        j.key("mode");        j.str(e.mode == RECORD_RAW ? "raw" : "avg");  j.ch(',');
+        j.key("record_ms");   j.u32(e.record_ms);                           j.ch(',');
+        j.key("bytes");       j.u32(e.bytes);                               j.ch(',');
+        j.key("records");     j.u32(e.records);                             j.ch(',');
+        j.key("sensors");
+        j.ch('[');
+        bool first_sensor = true;
+        for (int i = 0; i < NUM_SENSORS; i++) {
+            if (!(e.sensor_mask & (1ULL << i))) continue;
+            if (!first_sensor) j.ch(',');
+            first_sensor = false;
+            j.u32(i + 1);
+        }
+        j.raw("]}");
+    }
+    j.ch(']');
+    _server.sendContent(out, j.len);
+}
+
+static void _handle_run_download() {
+    uint32_t id = (uint32_t)_server.pathArg(0).toInt();
+    if (id == 0 || !stream_csv_to_client(_server, id)) {
+        _server.send(404, "text/plain", "No such run");
+    }
+}
+
+// Upper bound of one event object in /events
+#define EVENT_JSON_MAX  160
+
+// Events, oldest first, straight from the event index; an event whose
+// file could not be written is listed with "saved":false and no records
+static void _handle_events() {
+    uint32_t next = get_next_event_id();
+    uint32_t first = (next > EVENT_SLOTS) ? next - EVENT_SLOTS : 1;
+    _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server.send(200, "application/json", "");
+
+    static char out[1024];
+    JsonBuf j(out, sizeof(out));
+    j.ch('[');
+    bool any = false;
+    for (uint32_t id = first; id < next; id++) {
+        EventEntry e;
+        if (!get_event_entry(id, e)) continue;
+        if (j.len + EVENT_JSON_MAX > sizeof(out)) {
+            _server.sendContent(out, j.len);
+            j.len = 0;
+        }
+        if (any) j.ch(',');
+        any = true;
+        j.ch('{');
+        j.key("id");         j.u32(e.id);                        j.ch(',');
+        j.key("time");       j.u32(e.start_unix);                j.ch(',');
+        j.key("sensor");     j.u32(e.sensor + 1);                j.ch(',');
+        j.key("cause");      j.str(EVENT_CAUSE_NAMES[e.cause]);  j.ch(',');
+        j.key("value");      j.fixed(e.value, 3);                j.ch(',');
+        j.key("trigger_ms"); j.u32(e.trigger_ms);                j.ch(',');
+        j.key("records");    j.u32(e.records);                   j.ch(',');
+        j.key("bytes");      j.u32(e.bytes);                     j.ch(',');
+        j.key("saved");      j.boolean(!e.unsaved);
+        j.ch('}');
+    }
+    j.ch(']');
+    _server.sendContent(out, j.len);
+}
+
+static void _handle_event_download() {
+    uint32_t id = (uint32_t)_server.pathArg(0).toInt();
+    if (!stream_event_csv_to_client(_server, id)) {
+        _server.send(404, "text/plain", "No such event");
+    }
+}
+
+// Capture trigger of one sensor (see events.h). GET returns it; POST sets
+// any of low, high (mL/min), rate (mL/min/s), cv (%) first, where an empty
+// value or "off" disarms the condition, and error (1/0).
+static void _handle_event_trigger() {
+    int n = _server.pathArg(0).toInt();
+    if (n < 1 || n > NUM_SENSORS) {
+        _server.send(400, "text/plain", "Invalid sensor ID");
+        return;
+    }
+    EventTrigger tr = get_event_trigger(n - 1);
+    if (_server.method() == HTTP_POST) {
+        auto set = [&](const char* name, EventCause cause, float& limit) {
+            if (!_server.hasArg(name)) return;
+            const String& v = _server.arg(name);
+            if (v.length() == 0 || v == "off") {
+                tr.causes &= ~(1 << cause);
+            } else {
+                tr.causes |= 1 << cause;
+                limit = v.toFloat();
+            }
+        };
+        set("low", EVENT_LOW, tr.low);
+        set("high", EVENT_HIGH, tr.high);
+        set("rate", EVENT_RATE, tr.rate);
+        set("cv", EVENT_CV, tr.cv);
+        if (_server.hasArg("error")) {
+            if (_server.arg("error") == "1") tr.causes |= 1 << EVENT_ERROR;
+            else tr.causes &= ~(1 << EVENT_ERROR);
+        }
+        set_event_trigger(n - 1, tr);
+    }
+
+    // Disarmed conditions read as null
+    static char out[128];
+    JsonBuf j(out, sizeof(out));
+    auto limit = [&](const char* name, EventCause cause, float v) {
+        j.key(name);
+        if ((tr.causes >> cause) & 1) j.fixed(v, 3);
+        else j.raw("null");
+        j.ch(',');
+    };
+    j.raw("{\"sensor\":");
+    j.u32(n);
+    j.ch(',');
+    limit("low", EVENT_LOW, tr.low);
+    limit("high", EVENT_HIGH, tr.high);
+    limit("rate", EVENT_RATE, tr.rate);
+    limit("cv", EVENT_CV, tr.cv);
+    j.key("error");
+    j.boolean((tr.causes >> EVENT_ERROR) & 1);
+    j.ch('}');
+    _server.send(200, "application/json", out, j.len);
+}
+
+// Binary samples since a sequence number (see telemetry.h); without
+// `since` everything still in the ring. Sent in blocks from a small buffer.
+#define TELEM_SEND_BLOCK  512
+static void _handle_telemetry() {
+    SampleRange r;
+    get_sample_range(r);
+    uint32_t since = r.first;
+    if (_server.hasArg("since")) {
+        const String& arg = _server.arg("since");
+        char* end;
+        since = strtoul(arg.c_str(), &end, 10);
+        if (arg.length() == 0 || *end != '\0') {
+            _server.send(400, "text/plain", "since must be a sequence number");
+            return;
+        }
+    }
+
+    TelemetryHeader h;
+    telem_begin(h, r, since, UINT16_MAX);
+
+    static uint8_t out[TELEM_SEND_BLOCK];
+    static_assert(TELEM_PREAMBLE_SIZE + TELEM_RECORD_SIZE <= TELEM_SEND_BLOCK, "TELEM_SEND_BLOCK too small");
+    _server.sendHeader("Cache-Control", "no-store");
+    _server.setContentLength(TELEM_PREAMBLE_SIZE + (size_t)h.count * TELEM_RECORD_SIZE);
+    _server.send(200, "application/octet-stream", "");
+
+    // The ring cannot move meanwhile: samples are only pushed from loop()
+    size_t len = telem_write_preamble(out, h);
+    for (uint16_t k = 0; k < h.count; k++) {
+        if (len + TELEM_RECORD_SIZE > sizeof(out)) {
+            _server.sendContent((const char*)out, len);
+            len = 0;
+        }
+        len += get_telemetry_record(h.first_seq + k, out + len);
+    }
+    _server.sendContent((const char*)out, len);
+}
+
 static void _handle_sensor_toggle() {
     int sensor_id = _server.pathArg(0).toInt();
     String action = _server.pathArg(1);
@@ -597,24 +1135,92 @@ static void _handle_sensor_toggle() {
     
     if (sensor_id >= 1 && sensor_id <= NUM_SENSORS) {
         set_sensor_enabled((uint8_t)sensor_id, enable);
+        _api_toggles++;
         _server.send(200, "text/plain", enable ? "enabled" : "disabled");
     } else {
         _server.send(400, "text/plain", "Invalid sensor ID");
     }
 }
 
+// PID controller of one sensor (see pid.h). GET returns its state; POST
+// sets any of sp (setpoint, mL/min), kp, ki, kd and enable (1/0) first.
+static void _handle_pid() {
+    int n = _server.pathArg(0).toInt();
+    if (n < 1 || n > PID_CHANNELS) {
+        _server.send(404, "text/plain", "No controller for this sensor");
+        return;
+    }
+    uint8_t ch = n - 1;
+    PidController& c = _pid[ch];
+    if (_server.method() == HTTP_POST) {
+        if (_server.hasArg("sp")) c.setpoint = _server.arg("sp").toFloat();
+        if (_server.hasArg("kp")) c.kp = _server.arg("kp").toFloat();
+        if (_server.hasArg("ki")) c.ki = _server.arg("ki").toFloat();
+        if (_server.hasArg("kd")) c.kd = _server.arg("kd").toFloat();
+        if (_server.hasArg("enable")) pid_enable(ch, _server.arg("enable") == "1");
+    }
+
+    static char out[192];
+    JsonBuf j(out, sizeof(out));
+    j.ch('{');
+    j.key("sensor");     j.u32(n);                                      j.ch(',');
+    j.key("pin");        j.u32(PID_PWM_PINS[ch]);                       j.ch(',');
+    j.key("enabled");    j.boolean(c.enabled);                          j.ch(',');
+    j.key("setpoint");   j.fixed(c.setpoint, 3);                        j.ch(',');
+    j.key("kp");         j.fixed(c.kp, 4);                              j.ch(',');
+    j.key("ki");         j.fixed(c.ki, 4);                              j.ch(',');
+    j.key("kd");         j.fixed(c.kd, 4);                              j.ch(',');
+    j.key("flow");       j.fixed(c.flow, 3);                            j.ch(',');
+    j.key("output_pct"); j.fixed(c.output, 1);                          j.ch(',');
+    j.key("fault");      j.boolean(c.faults >= PID_FAULT_SAMPLES);
+    j.ch('}');
+    _server.send(200, "application/json", out, j.len);
+}
+
+// Zero the volume total of one sensor (/total/<n>/reset) or of all of
+// them (/total/reset)
+static void _handle_total_reset() {
+    int n = _server.pathArg(0).toInt();
+    if (n < 1 || n > NUM_SENSORS) {
+        _server.send(400, "text/plain", "Invalid sensor ID");
+        return;
+    }
+    reset_total((uint8_t)n);
+    _server.send(200, "text/plain", "reset");
+}
+
+static void _handle_total_reset_all() {
+    reset_total(0);
+    _server.send(200, "text/plain", "reset");
+}
+
 static void _handle_not_found() {
     _server.send(404, "text/plain", "404: Not Found");
 }
 
 // Setup and Loop Functions
 inline void web_begin() {
+    static const char* header_keys[] = { "If-None-Match" };
+    _server.collectHeaders(header_keys, 1);
     _server.on("/", HTTP_GET, _handle_root);
     _server.on("/api", HTTP_GET, _handle_api);
     _server.on("/start", HTTP_POST, _handle_start);
     _server.on("/stop", HTTP_POST, _handle_stop);
     _server.on("/log.csv", HTTP_GET, _handle_log);
+    _server.on("/perf", HTTP_GET, _handle_perf);
+    _server.on("/stream", HTTP_GET, _handle_stream);
+    _server.on("/runs", HTTP_GET, _handle_runs);
+    _server.on(UriRegex("/runs/(\\d+)"), HTTP_GET, _handle_run_download);
+    _server.on("/events", HTTP_GET, _handle_events);
+    _server.on(UriRegex("/events/(\\d+)"), HTTP_GET, _handle_event_download);
+    _server.on(UriRegex("/events/trigger/(\\d+)"), HTTP_ANY, _handle_event_trigger);
+    _server.on("/telemetry", HTTP_GET, _handle_telemetry);
+    _server.on("/history", HTTP_GET, _handle_history);
+    _server.on("/trend", HTTP_GET, _handle_trend);
+    _server.on(UriRegex("/pid/(\\d+)"), HTTP_ANY, _handle_pid);
     _server.on(UriRegex("/sensor/(\\d+)/(on|off)"), HTTP_POST, _handle_sensor_toggle);
+    _server.on("/total/reset", HTTP_POST, _handle_total_reset_all);
+    _server.on(UriRegex("/total/(\\d+)/reset"), HTTP_POST, _handle_total_reset);
     _server.onNotFound(_handle_not_found);
     _server.begin();
     Serial.println("[WEB] Server started on port 80");
@@ -622,4 +1228,5 @@ inline void web_begin() {
 
 inline void web_loop() { 
     _server.handleClient(); 
+    _sse_loop();
 }
\ No newline at end of file
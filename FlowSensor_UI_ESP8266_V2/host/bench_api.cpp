@@ -0,0 +1,130 @@
+// /api before and after the JsonBuf rewrite: heap allocations and host us
+// per response of the String-based handler the firmware used to have
+// (kept here with the fields /api has today) against _handle_api(), with
+// the snapshot rebuilt on every request and served from the cache.
+//
+//   bench_api [--requests N]
+//
+// Allocations are counted with the host String, which keeps strings of up
+// to 15 chars inline; the ESP8266 String keeps 11, so the device allocates
+// somewhat more in the String handler.
+#include <chrono>
+#include <new>
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+
+static bool     count_allocs = false;
+static uint64_t allocs = 0, alloc_bytes = 0;
+
+void* operator new(size_t n) {
+  if (count_allocs) {
+    allocs++;
+    alloc_bytes += n;
+  }
+  void* p = malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+// Out of line, or GCC warns about free() on memory from new once inlined
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { free(p); }
+
+// The handler before the JsonBuf rewrite
+static void legacy_handle_api() {
+    float f_1s[NUM_SENSORS], t_1s[NUM_SENSORS];
+    float m10[NUM_SENSORS], r10[NUM_SENSORS], cv10[NUM_SENSORS];
+    float p_hz[NUM_SENSORS], p_amp[NUM_SENSORS];
+    bool ok[NUM_SENSORS];
+    bool rec, csv;
+
+    get_ui_snapshot(f_1s, t_1s, m10, r10, cv10, ok, rec, csv);
+    get_pulsation(p_hz, p_amp);
+
+    String json;
+    json.reserve(NUM_SENSORS * API_SENSOR_JSON_MAX + 64);
+    json += "{";
+    for (int i = 0; i < NUM_SENSORS; i++) {
+        json += "\"s" + String(i + 1) + "\":{";
+        json += "\"flow_1s\":" + String(f_1s[i], 3) + ",";
+        json += "\"temp_1s\":" + String(t_1s[i], 3) + ",";
+        json += "\"mean10\":" + String(m10[i], 3) + ",";
+        json += "\"rms10\":" + String(r10[i], 3) + ",";
+        json += "\"cv10\":" + String(cv10[i], 2) + ",";
+        json += "\"pulse_hz\":" + String(p_hz[i], 2) + ",";
+        json += "\"pulse_amp\":" + String(p_amp[i], 3) + ",";
+        json += "\"total_ml\":" + String(total_ul(i) / 1000.0, 3) + ",";
+        json += "\"ok\":" + String(ok[i] ? "true" : "false") + ",";
+        json += "\"enabled\":" + String(get_sensor_enabled((uint8_t)(i + 1)) ? "true" : "false");
+        json += "}";
+        if (i < NUM_SENSORS - 1) json += ",";
+    }
+
+    json += ",\"run\":{";
+    json += "\"recording\":" + String(rec ? "true" : "false") + ",";
+    json += "\"csv_ready\":" + String(csv ? "true" : "false") + ",";
+    uint8_t mode;
+    uint32_t bps, dropped;
+    float ratio;
+    get_run_stats(mode, bps, dropped, ratio);
+    json += "\"mode\":\"" + String(mode == RECORD_RAW ? "raw" : "avg") + "\",";
+    json += "\"write_bps\":" + String(bps) + ",";
+    json += "\"dropped\":" + String(dropped) + ",";
+    json += "\"compression\":" + String(ratio, 2);
+    json += "}}";
+
+    _server.send(200, "application/json", json);
+}
+
+struct Result {
+  double allocs, bytes, us;
+};
+
+// Per call averages; `before` runs ahead of every call, untimed and uncounted
+template <typename F, typename G>
+static Result measure(int n, F handler, G before) {
+  uint64_t a = 0, b = 0;
+  double ns = 0;
+  for (int k = 0; k < n; k++) {
+    before();
+    allocs = alloc_bytes = 0;
+    count_allocs = true;
+    auto t0 = std::chrono::steady_clock::now();
+    handler();
+    auto t1 = std::chrono::steady_clock::now();
+    count_allocs = false;
+    a += allocs;
+    b += alloc_bytes;
+    ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+  }
+  return Result{ (double)a / n, (double)b / n, ns / 1e3 / n };
+}
+
+int main(int argc, char** argv) {
+  int requests = 20000;
+  for (int a = 1; a < argc; a++) {
+    if (!strcmp(argv[a], "--requests") && a + 1 < argc) requests = atoi(argv[++a]);
+  }
+
+  // A live snapshot: recording, totals and pulsation filled in
+  host_boot("bench_api");
+  _server.request(HTTP_POST, "/start");
+  host_run_ms(30000);
+
+  legacy_handle_api();
+  std::string legacy = _server.response.body;
+  _handle_api();
+  bool same = legacy == _server.response.body;
+
+  auto nothing = [] {};
+  auto stale = [] { _api_len = 0; };
+  Result old_api = measure(requests, legacy_handle_api, nothing);
+  Result rebuilt = measure(requests, _handle_api, stale);
+  Result cached = measure(requests, _handle_api, nothing);
+
+  printf("/api, %d sensors, %zu bytes, bodies %s\n", NUM_SENSORS, legacy.size(), same ? "identical" : "DIFFER");
+  printf("%-26s %12s %12s %10s\n", "handler", "allocs/resp", "bytes/resp", "us/resp");
+  printf("%-26s %12.1f %12.0f %10.3f\n", "String (before)", old_api.allocs, old_api.bytes, old_api.us);
+  printf("%-26s %12.1f %12.0f %10.3f\n", "JsonBuf, rebuilt", rebuilt.allocs, rebuilt.bytes, rebuilt.us);
+  printf("%-26s %12.1f %12.0f %10.3f\n", "JsonBuf, cached snapshot", cached.allocs, cached.bytes, cached.us);
+  return same && rebuilt.allocs == 0 ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+// Pipeline benchmark: one simulated hour of acquisition and recording with a
+// dashboard polling /api once a second, timing every PERF_SCOPE section
+// with the host clock.
+//
+//   bench_pipeline [--raw] [--minutes N]
+//
+// Times are host CPU times: compare them between builds, not with the
+// ESP8266, which is one to two orders of magnitude slower.
+#include <chrono>
+#include <cstdint>
+
+static uint64_t bench_ns[16];
+static uint32_t bench_calls[16];
+
+struct BenchScope {
+  int s;
+  std::chrono::steady_clock::time_point t0;
+  explicit BenchScope(int sec) : s(sec), t0(std::chrono::steady_clock::now()) {}
+  ~BenchScope() {
+    bench_ns[s] += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count();
+    bench_calls[s]++;
+  }
+};
+#define PERF_SCOPE(sec) BenchScope _bench_scope_##sec(sec)
+
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+
+// Cost of the timer itself, subtracted from every call
+static double bench_overhead_ns() {
+  const int N = 1000000, SLOT = 15;
+  for (int k = 0; k < N; k++) {
+    BenchScope t(SLOT);
+  }
+  double ns = (double)bench_ns[SLOT] / N;
+  bench_ns[SLOT] = 0;
+  bench_calls[SLOT] = 0;
+  return ns;
+}
+
+int main(int argc, char** argv) {
+  bool raw = false;
+  uint32_t minutes = 60;
+  for (int a = 1; a < argc; a++) {
+    if (!strcmp(argv[a], "--raw")) raw = true;
+    else if (!strcmp(argv[a], "--minutes") && a + 1 < argc) minutes = atoi(argv[++a]);
+  }
+
+  double overhead_ns = bench_overhead_ns();
+  host_boot("bench_pipeline");
+  host_run_ms(1000);   // Sensor warm-up and filter settling
+  _server.request(HTTP_POST, "/start", { { "mode", raw ? "raw" : "avg" } });
+  memset(bench_ns, 0, sizeof(bench_ns));
+  memset(bench_calls, 0, sizeof(bench_calls));
+  uint32_t i2c_start = host_i2c_transactions;
+  uint64_t bus_start = host_i2c_bus_us;
+  uint64_t t_start = host_time_us;
+
+  for (uint32_t s = 0; s < minutes * 60; s++) {
+    host_run_ms(1000);
+    if (_server.request(HTTP_GET, "/api") != 200) {
+      fprintf(stderr, "/api failed: %d\n", _server.response.code);
+      return 1;
+    }
+  }
+  double hours = (host_time_us - t_start) / 3.6e9;
+  _server.request(HTTP_POST, "/stop");
+
+  printf("%d sensors, %s recording, %.0f simulated s\n", NUM_SENSORS, raw ? "raw" : "avg", hours * 3600);
+  printf("timer overhead %.1f ns/call, subtracted\n", overhead_ns);
+  printf("%-20s %10s %10s %12s\n", "section", "calls", "us/call", "ms/hour");
+  const int sections[] = { PERF_ACQ_STEP, PERF_PUSH_SAMPLE, PERF_MEANS_1S, PERF_METRICS_10S,
+                           PERF_RECORD, PERF_API, PERF_FFT, PERF_EVENTS };
+  for (int s : sections) {
+    if (bench_calls[s] == 0) continue;
+    double ns = std::max(0.0, bench_ns[s] - overhead_ns * bench_calls[s]);
+    printf("%-20s %10u %10.3f %12.1f\n", PERF_NAMES[s], bench_calls[s],
+           ns / 1e3 / bench_calls[s], ns / 1e6 / hours);
+  }
+  printf("I2C: %.0f transactions/hour, bus busy %.1f s/hour (simulated)\n",
+         (host_i2c_transactions - i2c_start) / hours, (host_i2c_bus_us - bus_start) / 1e6 / hours);
+  return 0;
+}
@@ -0,0 +1,119 @@
+// Run format benchmark: records a synthetic trace through the whole sketch
+// in both recording modes and compares the run file with the CSV it
+// downloads as, which is what the firmware used to write while recording.
+// Reports bytes per record and host us per record to encode, decode, and
+// format as CSV.
+//
+//   bench_runlog [--minutes N]
+//
+// Trace: 12 mL/min with a 2 Hz pump ripple and read noise on every sensor,
+// a step to 18 mL/min halfway, and the temperature drifting by 1 degree.
+#include <chrono>
+#include <random>
+#include <vector>
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+
+static std::mt19937 rng(1);
+static uint64_t step_at_us = UINT64_MAX;   // Halfway through the recording
+
+static bool trace(uint8_t, uint8_t channel, uint8_t, int16_t& flow, int16_t& temp) {
+  double t = host_time_us / 1e6;
+  double level = host_time_us >= step_at_us ? 9000 : 6000;
+  double ripple = 150 * sin(2 * M_PI * 2.0 * t + channel);
+  flow = (int16_t)lround(level + ripple + std::normal_distribution<double>(0, 20)(rng));
+  temp = (int16_t)lround(200 * (23.0 + t / 3600.0));
+  return true;
+}
+
+static double now_ns() {
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct Decoded {
+  RunFileHeader h;
+  RunScale scales[NUM_SENSORS];
+  std::vector<uint32_t> t;
+  std::vector<int16_t> w;
+  uint8_t words;
+};
+
+static Decoded decode_run(const char* path) {
+  Decoded d;
+  File f = LittleFS.open(path, "r");
+  run_read_header(f, d.h, d.scales);
+  d.words = 2 * run_mask_count(d.h.sensor_mask);
+  static RunDecoder dec;
+  dec.begin(f, d.h);
+  uint32_t t_ms;
+  int16_t w[RUN_WORDS_MAX];
+  while (dec.next(t_ms, w)) {
+    d.t.push_back(t_ms);
+    d.w.insert(d.w.end(), w, w + d.words);
+  }
+  f.close();
+  return d;
+}
+
+static void bench(RecordMode mode, uint32_t minutes) {
+  step_at_us = host_time_us + minutes * 30000000ULL;
+  _server.request(HTTP_POST, "/start", { { "mode", mode == RECORD_RAW ? "raw" : "avg" } });
+  host_run_ms(minutes * 60000);
+  _server.request(HTTP_POST, "/stop");
+
+  char path[32];
+  run_path(path, sizeof(path), run_id);
+  File f = LittleFS.open(path, "r");
+  size_t file_bytes = f.size();
+  f.close();
+  Decoded d = decode_run(path);
+  size_t records = d.t.size();
+  size_t data_bytes = file_bytes - run_data_offset(d.h.num_sensors);
+
+  // CSV as downloaded, less the header line
+  _server.request(HTTP_GET, "/log.csv");
+  const std::string& csv = _server.response.body;
+  size_t csv_bytes = csv.size() - (csv.find('\n') + 1);
+
+  const int REPEAT = 20;
+  uint8_t rec[RUN_ENCODED_MAX];
+  size_t sink = 0;
+  RunEncoder enc;
+  double t0 = now_ns();
+  for (int r = 0; r < REPEAT; r++) {
+    enc.reset();
+    for (size_t k = 0; k < records; k++) sink += enc.encode(rec, d.t[k], &d.w[k * d.words], d.words);
+  }
+  double encode_us = (now_ns() - t0) / 1e3 / REPEAT / records;
+
+  t0 = now_ns();
+  for (int r = 0; r < REPEAT; r++) sink += decode_run(path).t.size();
+  double decode_us = (now_ns() - t0) / 1e3 / REPEAT / records;
+
+  char row[16 + 30 * NUM_SENSORS];
+  t0 = now_ns();
+  for (int r = 0; r < REPEAT; r++) {
+    for (size_t k = 0; k < records; k++) sink += run_csv_row(row, sizeof(row), d.t[k], &d.w[k * d.words], d.h, d.scales);
+  }
+  double csv_us = (now_ns() - t0) / 1e3 / REPEAT / records;
+
+  printf("%s: %zu records of %d sensors\n", mode == RECORD_RAW ? "raw (20 Hz)" : "avg (2 Hz)", records, NUM_SENSORS);
+  printf("  run file  %8.2f bytes/record  encode %6.3f us/record  decode %6.3f us/record (file read included)\n",
+         (double)data_bytes / records, encode_us, decode_us);
+  printf("  CSV       %8.2f bytes/record  format %6.3f us/record\n", (double)csv_bytes / records, csv_us);
+  printf("  ratio     %8.2fx smaller\n", (double)csv_bytes / data_bytes);
+  if (sink == 0) printf("\n");
+}
+
+int main(int argc, char** argv) {
+  uint32_t minutes = 10;
+  for (int a = 1; a < argc; a++) {
+    if (!strcmp(argv[a], "--minutes") && a + 1 < argc) minutes = atoi(argv[++a]);
+  }
+  host_sensor_read = trace;
+  host_boot("bench_runlog");
+  host_run_ms(1000);
+  bench(RECORD_AVG, minutes);
+  bench(RECORD_RAW, minutes);
+  return 0;
+}
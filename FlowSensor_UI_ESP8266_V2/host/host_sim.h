@@ -0,0 +1,30 @@
+#pragma once
+// Drives the sketch on the host. Include after FlowSensor_UI_ESP8266.ino.
+#include <filesystem>
+#include <string>
+
+// CPU time of one loop() pass besides its bus transfers, in simulated us
+#ifndef HOST_PASS_US
+#define HOST_PASS_US 100
+#endif
+
+// Boot on an empty file system of its own in the temp directory
+inline void host_boot(const char* name) {
+  host_fs_root = (std::filesystem::temp_directory_path() / (std::string("flowsensor_") + name)).string();
+  host_fs_reset();
+  host_serial_quiet = true;
+  host_time_us = 0;
+  setup();
+}
+
+// Run loop() until the simulated clock reaches `until_us`
+inline void host_run_until(uint64_t until_us) {
+  while (host_time_us < until_us) {
+    loop();
+    host_time_us += HOST_PASS_US;
+  }
+}
+
+inline void host_run_ms(uint32_t ms) {
+  host_run_until(host_time_us + (uint64_t)ms * 1000);
+}
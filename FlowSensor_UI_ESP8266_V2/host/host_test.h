@@ -0,0 +1,18 @@
+#pragma once
+// Minimal checks for the host tests: report every failure, exit non-zero
+#include <cstdio>
+
+static int host_failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+      host_failures++; \
+      fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+  } while (0)
+
+inline int host_test_result() {
+  if (host_failures) fprintf(stderr, "%d check(s) failed\n", host_failures);
+  else printf("all checks passed\n");
+  return host_failures ? 1 : 0;
+}
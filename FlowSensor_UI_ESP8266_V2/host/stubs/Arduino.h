@@ -0,0 +1,155 @@
+#pragma once
+// Host stand-in for the ESP8266 Arduino core: just enough of the API the
+// sketch uses, with a simulated clock (see host_sim.h)
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PGM_P     const char*
+#define PSTR(s)   (s)
+#define F(s)      (s)
+#define FPSTR(p)  (p)
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+
+#define LOW     0
+#define HIGH    1
+#define INPUT   0
+#define OUTPUT  1
+
+using std::isinf;
+using std::isnan;
+using std::max;
+using std::min;
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+// Simulated time: only host_sim.h and the bus stand-in advance it
+extern uint64_t host_time_us;
+inline unsigned long millis() { return (uint32_t)(host_time_us / 1000); }
+inline unsigned long micros() { return (uint32_t)host_time_us; }
+inline void delay(unsigned long ms) { host_time_us += (uint64_t)ms * 1000; }
+inline void delayMicroseconds(unsigned int us) { host_time_us += us; }
+inline void yield() {}
+
+// GPIO: PWM duty per pin is kept for the tests
+extern int host_pwm[17];
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void analogWrite(uint8_t pin, int value) { if (pin < 17) host_pwm[pin] = value; }
+inline void analogWriteRange(uint32_t) {}
+inline void analogWriteFreq(uint32_t) {}
+
+inline void* memcpy_P(void* dst, const void* src, size_t n) { return memcpy(dst, src, n); }
+inline size_t strlen_P(const char* s) { return strlen(s); }
+inline uint8_t pgm_read_byte(const void* p) { return *(const uint8_t*)p; }
+
+// Arduino String over std::string; allocates on the heap like the real one
+class String {
+ public:
+  std::string s;
+
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(const std::string& c) : s(c) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  String(float v, unsigned char decimals = 2) { format(v, decimals); }
+  String(double v, unsigned char decimals = 2) { format(v, decimals); }
+
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char o) { s += o; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+  friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+  bool operator==(const char* o) const { return s == o; }
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator!=(const char* o) const { return s != o; }
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  bool reserve(unsigned n) { s.reserve(n); return true; }
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return (float)atof(s.c_str()); }
+
+ private:
+  void format(double v, unsigned char decimals) {
+    char b[48];
+    snprintf(b, sizeof(b), "%.*f", decimals, v);
+    s = b;
+  }
+};
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(const uint8_t* b, size_t n) = 0;
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t write(const char* s, size_t n) { return write((const uint8_t*)s, n); }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v, int decimals = 2) { return printf("%.*f", decimals, v); }
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(T v) { return print(v) + println(); }
+
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char b[1024];
+    va_list a;
+    va_start(a, fmt);
+    int n = vsnprintf(b, sizeof(b), fmt, a);
+    va_end(a);
+    return write((const uint8_t*)b, std::min(n, (int)sizeof(b) - 1));
+  }
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+};
+
+// Serial output goes to stderr unless a program silences it
+extern bool host_serial_quiet;
+
+class HardwareSerial : public Stream {
+ public:
+  using Print::write;
+  void begin(unsigned long) {}
+  size_t write(const uint8_t* b, size_t n) override {
+    return host_serial_quiet ? n : fwrite(b, 1, n, stderr);
+  }
+};
+
+extern HardwareSerial Serial;
+
+inline void configTime(int, int, const char*) {}
+
+struct EspClass {
+  uint32_t random() { return (uint32_t)rand() * 2654435761u; }
+  uint32_t getFreeHeap() { return 40000; }
+  uint32_t getMaxFreeBlockSize() { return 30000; }
+  uint8_t getHeapFragmentation() { return 0; }
+};
+
+extern EspClass ESP;
\ No newline at end of file
@@ -0,0 +1,118 @@
+#pragma once
+// Host stand-in for ESP8266WebServer. request() dispatches like
+// handleClient() would; the response is collected in `response`.
+#include <functional>
+#include <map>
+#include <regex>
+#include <vector>
+#include "ESP8266WiFi.h"
+#include "uri/UriRegex.h"
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+// Simulated link speed: sending a response body advances the clock by this
+// much per byte, as a client draining the socket would (0 = instant)
+extern uint32_t host_link_us_per_byte;
+
+struct HostResponse {
+  int code = 0;
+  std::string content_type;
+  std::map<std::string, std::string> headers;
+  size_t content_length = 0;
+  std::string body;
+};
+
+class ESP8266WebServer {
+ public:
+  typedef std::function<void()> THandlerFunction;
+
+  HostResponse response;
+
+  ESP8266WebServer(int) {}
+  void begin() {}
+  void handleClient() {}
+  void keepAlive(bool) {}
+
+  void on(const Uri& uri, HTTPMethod method, THandlerFunction fn) {
+    _routes.push_back({ uri.pattern.s, method, fn });
+  }
+  void on(const UriRegex& uri, HTTPMethod method, THandlerFunction fn) {
+    _routes.push_back({ "^" + uri.pattern.s + "$", method, fn, true });
+  }
+  void onNotFound(THandlerFunction fn) { _not_found = fn; }
+  template <typename... T> void collectHeaders(T...) {}
+
+  // Run the handler for one request; query args and headers as name/value pairs
+  int request(HTTPMethod method, const std::string& path,
+              const std::map<std::string, std::string>& args = {},
+              const std::map<std::string, std::string>& headers = {}) {
+    response = HostResponse();
+    _method = method;
+    _args = args;
+    _headers = headers;
+    _path_args.clear();
+    for (const Route& r : _routes) {
+      if (r.method != HTTP_ANY && r.method != method) continue;
+      if (!r.regex) {
+        if (r.pattern != path) continue;
+      } else {
+        std::smatch m;
+        if (!std::regex_match(path, m, std::regex(r.pattern))) continue;
+        for (size_t i = 1; i < m.size(); i++) _path_args.push_back(m[i]);
+      }
+      r.fn();
+      return response.code;
+    }
+    if (_not_found) _not_found();
+    return response.code;
+  }
+
+  void send(int code, const char* type = nullptr, const char* body = "") { send(code, type, body, strlen(body)); }
+  void send(int code, const char* type, const String& body) { send(code, type, body.c_str(), body.length()); }
+  void send(int code, const char* type, const char* body, size_t n) {
+    response.code = code;
+    response.content_type = type ? type : "";
+    response.body.assign(body, n);
+  }
+  void send_P(int code, PGM_P type, PGM_P body) { send(code, type, body); }
+  void send_P(int code, PGM_P type, PGM_P body, size_t n) { send(code, type, body, n); }
+  void sendHeader(const String& name, const String& value, bool = false) { response.headers[name.s] = value.s; }
+  void setContentLength(size_t n) { response.content_length = n; }
+  void sendContent(const String& s) { sendContent(s.c_str(), s.length()); }
+  void sendContent(const char* s, size_t n) {
+    response.body.append(s, n);
+    host_time_us += (uint64_t)n * host_link_us_per_byte;
+  }
+  void sendContent_P(PGM_P s) { sendContent(s, strlen(s)); }
+  void sendContent_P(PGM_P s, size_t n) { sendContent(s, n); }
+
+  HTTPMethod method() const { return _method; }
+  bool hasArg(const String& name) const { return _args.count(name.s); }
+  String arg(const String& name) const {
+    auto it = _args.find(name.s);
+    return it == _args.end() ? String() : String(it->second);
+  }
+  String pathArg(unsigned i) const { return i < _path_args.size() ? String(_path_args[i]) : String(); }
+  String header(const String& name) const {
+    auto it = _headers.find(name.s);
+    return it == _headers.end() ? String() : String(it->second);
+  }
+  bool hasHeader(const String& name) const { return _headers.count(name.s); }
+  WiFiClient& client() { return _client; }
+
+ private:
+  struct Route {
+    std::string      pattern;
+    HTTPMethod       method;
+    THandlerFunction fn;
+    bool             regex = false;
+  };
+  std::vector<Route> _routes;
+  THandlerFunction   _not_found;
+  HTTPMethod         _method = HTTP_GET;
+  std::map<std::string, std::string> _args, _headers;
+  std::vector<std::string> _path_args;
+  WiFiClient         _client;
+};
@@ -0,0 +1,59 @@
+#pragma once
+// Host stand-in for the ESP8266 WiFi library: always connected, and TCP
+// clients that keep what is written to them
+#include "Arduino.h"
+
+class IPAddress {
+ public:
+  uint8_t b[4] = {};
+
+  IPAddress() {}
+  IPAddress(uint8_t a0, uint8_t a1, uint8_t a2, uint8_t a3) : b{a0, a1, a2, a3} {}
+  bool fromString(const char* s) { return sscanf(s, "%hhu.%hhu.%hhu.%hhu", &b[0], &b[1], &b[2], &b[3]) == 4; }
+  bool isSet() const { return b[0] | b[1] | b[2] | b[3]; }
+  uint8_t operator[](int i) const { return b[i]; }
+  String toString() const {
+    char s[16];
+    snprintf(s, sizeof(s), "%u.%u.%u.%u", b[0], b[1], b[2], b[3]);
+    return String(s);
+  }
+};
+
+#define WIFI_STA       1
+#define WIFI_NONE_SLEEP 0
+#define WL_CONNECTED   3
+
+class WiFiClass {
+ public:
+  void mode(int) {}
+  void begin(const char*, const char*) {}
+  int status() { return WL_CONNECTED; }
+  IPAddress localIP() { return IPAddress(192, 168, 4, 2); }
+  void setSleepMode(int) {}
+};
+
+extern WiFiClass WiFi;
+
+class WiFiClient : public Stream {
+ public:
+  using Print::write;
+  bool        open = false;
+  size_t      window = 1460;   // Reported by availableForWrite()
+  std::string out;
+
+  size_t write(const uint8_t* b, size_t n) override {
+    out.append((const char*)b, n);
+    return n;
+  }
+  size_t write_P(PGM_P b, size_t n) { return write((const uint8_t*)b, n); }
+  uint8_t connected() { return open; }
+  size_t availableForWrite() { return window; }
+  void setNoDelay(bool) {}
+  void setSync(bool) {}
+  void flush() {}
+  void stop() { open = false; }
+  IPAddress remoteIP() { return IPAddress(); }
+  explicit operator bool() { return open; }
+};
+
+#include "WiFiUdp.h"
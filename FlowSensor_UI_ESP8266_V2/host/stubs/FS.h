@@ -0,0 +1,137 @@
+#pragma once
+// Host stand-in for the Arduino FS API, backed by a directory of the host
+// file system (host_fs_root)
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include "Arduino.h"
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct FSInfo {
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+extern std::string host_fs_root;    // Directory standing in for the flash
+extern size_t      host_fs_total;   // Reported partition size
+extern uint32_t    host_fs_read_us_per_byte;   // Simulated flash read time (0 = instant)
+extern size_t      host_fs_write_budget;       // Bytes that still reach a file, then writes come up short
+
+// Empty the file system
+void host_fs_reset();
+
+namespace fs {
+
+class File : public Stream {
+ public:
+  using Print::write;
+
+  File() {}
+  File(FILE* fp, const std::string& name) : _fp(fp), _name(name) {}
+  explicit operator bool() const { return _fp != nullptr; }
+
+  size_t write(const uint8_t* b, size_t n) override {
+    if (!_fp) return 0;
+    size_t k = fwrite(b, 1, std::min(n, host_fs_write_budget), _fp);
+    if (host_fs_write_budget != SIZE_MAX) host_fs_write_budget -= k;
+    return k;
+  }
+  int read() override { return _fp ? fgetc(_fp) : -1; }
+  size_t read(uint8_t* b, size_t n) {
+    size_t got = _fp ? fread(b, 1, n, _fp) : 0;
+    host_time_us += (uint64_t)got * host_fs_read_us_per_byte;
+    return got;
+  }
+  int available() override { return (int)(size() - position()); }
+  int peek() {
+    int c = read();
+    if (c >= 0) ungetc(c, _fp);
+    return c;
+  }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet) {
+    return _fp && fseek(_fp, pos, mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END) == 0;
+  }
+  size_t position() const { return _fp ? ftell(_fp) : 0; }
+  size_t size() const {
+    if (!_fp) return 0;
+    long p = ftell(_fp);
+    fseek(_fp, 0, SEEK_END);
+    long end = ftell(_fp);
+    fseek(_fp, p, SEEK_SET);
+    return end;
+  }
+  void flush() { if (_fp) fflush(_fp); }
+  bool truncate(uint32_t n);
+  void close() {
+    if (_fp) fclose(_fp);
+    _fp = nullptr;
+  }
+  const char* name() const { return _name.c_str(); }
+  bool isFile() const { return true; }
+
+ private:
+  FILE*       _fp = nullptr;
+  std::string _name;
+};
+
+class Dir {
+ public:
+  Dir() {}
+  explicit Dir(const std::string& path) : _path(path) {
+    std::error_code ec;
+    _it = std::filesystem::directory_iterator(host_fs_root + path, ec);
+  }
+  bool next() {
+    if (_started && _it != std::filesystem::directory_iterator()) ++_it;
+    _started = true;
+    return _it != std::filesystem::directory_iterator();
+  }
+  String fileName() { return String(_it->path().filename().string()); }
+  size_t fileSize() { return _it->is_regular_file() ? _it->file_size() : 0; }
+  bool isDirectory() { return _it->is_directory(); }
+
+ private:
+  std::string _path;
+  std::filesystem::directory_iterator _it;
+  bool _started = false;
+};
+
+class FS {
+ public:
+  bool begin() {
+    std::filesystem::create_directories(host_fs_root);
+    return true;
+  }
+  bool format() {
+    host_fs_reset();
+    return true;
+  }
+  bool info(FSInfo& info);
+
+  File open(const char* path, const char* mode) {
+    return File(fopen(_path(path).c_str(), (std::string(mode) + "b").c_str()), path);
+  }
+  File open(const String& path, const char* mode) { return open(path.c_str(), mode); }
+  bool exists(const char* path) { return std::filesystem::exists(_path(path)); }
+  bool exists(const String& path) { return exists(path.c_str()); }
+  bool remove(const char* path) { return ::remove(_path(path).c_str()) == 0; }
+  bool remove(const String& path) { return remove(path.c_str()); }
+  bool rename(const char* from, const char* to) { return ::rename(_path(from).c_str(), _path(to).c_str()) == 0; }
+  bool mkdir(const char* path) { return std::filesystem::create_directory(_path(path)); }
+  bool mkdir(const String& path) { return mkdir(path.c_str()); }
+  Dir openDir(const char* path) { return Dir(path); }
+
+ private:
+  std::string _path(const char* path) { return host_fs_root + path; }
+};
+
+}  // namespace fs
+
+using fs::Dir;
+using fs::File;
+using fs::FS;
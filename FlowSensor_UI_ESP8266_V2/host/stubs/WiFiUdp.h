@@ -0,0 +1,22 @@
+#pragma once
+// Host stand-in for WiFiUDP: keeps the last packet and counts sends
+#include "Arduino.h"
+
+class IPAddress;
+
+class WiFiUDP : public Print {
+ public:
+  using Print::write;
+  std::string packet;
+  size_t      sent = 0;
+
+  uint8_t begin(uint16_t) { return 1; }
+  int beginPacket(const IPAddress&, uint16_t) { packet.clear(); return 1; }
+  int beginPacketMulticast(const IPAddress&, uint16_t, const IPAddress&, int = 1) { packet.clear(); return 1; }
+  size_t write(const uint8_t* b, size_t n) override {
+    packet.append((const char*)b, n);
+    return n;
+  }
+  int endPacket() { sent++; return 1; }
+  void stop() {}
+};
@@ -0,0 +1,110 @@
+#pragma once
+// Host stand-in for the I2C bus: TCA9548A muxes at 0x70..0x77 and sensors
+// answering through host_sensor_read() on the channel that is open. Every
+// transfer advances the simulated clock by its time on the wire.
+#include "Arduino.h"
+
+// Words of the sensor at `addr` behind mux/channel; false = no ACK. The
+// default answers with host_default_flow/temp on every route.
+typedef bool (*HostSensorRead)(uint8_t mux, uint8_t channel, uint8_t addr, int16_t& flow, int16_t& temp);
+extern HostSensorRead host_sensor_read;
+extern int16_t host_default_flow;   // 6000 = 12 mL/min at the SLF3X scale
+extern int16_t host_default_temp;
+extern uint8_t host_muxes_present;   // Bit n: mux n ACKs (default all)
+
+// Bus statistics since boot
+extern uint32_t host_i2c_transactions;   // Completed writes and reads
+extern uint64_t host_i2c_bus_us;         // Simulated time on the wire
+
+class TwoWire {
+ public:
+  void begin(int, int) {}
+  void begin() {}
+  void setClock(uint32_t hz) { clock_hz = hz; }
+  void setClockStretchLimit(uint32_t) {}
+
+  void beginTransmission(uint8_t addr) {
+    tx_addr = addr;
+    tx_len = 0;
+  }
+
+  size_t write(uint8_t v) {
+    if (tx_len < sizeof(tx)) tx[tx_len++] = v;
+    return 1;
+  }
+
+  uint8_t endTransmission(bool = true) {
+    transfer(tx_len);
+    if (tx_addr >= 0x70 && tx_addr <= 0x77) {
+      uint8_t mux = tx_addr - 0x70;
+      if (!(host_muxes_present & (1 << mux))) return 2;
+      if (tx_len) mux_open[mux] = tx[0];
+      return 0;
+    }
+    uint8_t mux, channel;
+    return route(mux, channel) ? 0 : 2;   // 2: address NACK
+  }
+
+  uint8_t requestFrom(int addr, int n) {
+    transfer(n);
+    rx_len = rx_pos = 0;
+    uint8_t mux, channel;
+    int16_t flow, temp;
+    if (!route(mux, channel) || !host_sensor_read(mux, channel, (uint8_t)addr, flow, temp)) return 0;
+    uint8_t w[6] = { (uint8_t)(flow >> 8), (uint8_t)flow, 0, (uint8_t)(temp >> 8), (uint8_t)temp, 0 };
+    w[2] = crc8(w);
+    w[5] = crc8(w + 3);
+    rx_len = std::min(n, 6);
+    memcpy(rx, w, rx_len);
+    return rx_len;
+  }
+
+  int available() { return rx_len - rx_pos; }
+  int read() { return rx_pos < rx_len ? rx[rx_pos++] : -1; }
+
+  uint8_t mux_open[8] = {};   // Channel mask written to each mux
+
+ private:
+  uint32_t clock_hz = 100000;
+  uint8_t  tx_addr = 0;
+  uint8_t  tx[8];
+  size_t   tx_len = 0;
+  uint8_t  rx[6];
+  int      rx_len = 0, rx_pos = 0;
+
+  // Address + data bytes of 9 clocks each, plus start and stop
+  void transfer(size_t bytes) {
+    uint64_t us = ((1 + bytes) * 9 + 2) * 1000000ULL / clock_hz;
+    host_time_us += us;
+    host_i2c_bus_us += us;
+    host_i2c_transactions++;
+  }
+
+  // The one open channel, if exactly one is open on the whole bus (an
+  // absent mux carries nothing)
+  bool route(uint8_t& mux, uint8_t& channel) {
+    int open = 0;
+    for (uint8_t m = 0; m < 8; m++) {
+      if (!(host_muxes_present & (1 << m))) continue;
+      for (uint8_t c = 0; c < 8; c++) {
+        if (mux_open[m] & (1 << c)) {
+          mux = m;
+          channel = c;
+          open++;
+        }
+      }
+    }
+    return open == 1;
+  }
+
+  static uint8_t crc8(const uint8_t* d) {
+    uint8_t crc = 0xFF;
+    for (int i = 0; i < 2; i++) {
+      crc ^= d[i];
+      for (int b = 0; b < 8; b++) crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : crc << 1;
+    }
+    return crc;
+  }
+};
+
+extern TwoWire Wire;
\ No newline at end of file
@@ -0,0 +1,60 @@
+// Globals of the host stand-ins
+#include <filesystem>
+#include "Arduino.h"
+#include "ESP8266WiFi.h"
+#include "ESP8266mDNS.h"
+#include "LittleFS.h"
+#include "Wire.h"
+
+uint64_t host_time_us = 0;
+int      host_pwm[17];
+bool     host_serial_quiet = false;
+
+int16_t  host_default_flow = 6000;
+int16_t  host_default_temp = 23 * 200;
+uint8_t  host_muxes_present = 0xFF;
+uint32_t host_i2c_transactions = 0;
+uint64_t host_i2c_bus_us = 0;
+
+static bool host_default_sensor(uint8_t, uint8_t, uint8_t, int16_t& flow, int16_t& temp) {
+  flow = host_default_flow;
+  temp = host_default_temp;
+  return true;
+}
+HostSensorRead host_sensor_read = host_default_sensor;
+
+uint32_t host_link_us_per_byte = 0;
+
+std::string host_fs_root = "host_fs";   // Set by host_boot()
+size_t      host_fs_total = 1024 * 1024;
+uint32_t    host_fs_read_us_per_byte = 0;
+size_t      host_fs_write_budget = SIZE_MAX;
+
+void host_fs_reset() {
+  std::filesystem::remove_all(host_fs_root);
+  std::filesystem::create_directories(host_fs_root);
+}
+
+bool fs::File::truncate(uint32_t n) {
+  if (!_fp) return false;
+  fflush(_fp);
+  std::error_code ec;
+  std::filesystem::resize_file(host_fs_root + _name, n, ec);
+  return !ec;
+}
+
+bool fs::FS::info(FSInfo& info) {
+  size_t used = 0;
+  for (auto& e : std::filesystem::recursive_directory_iterator(host_fs_root)) {
+    if (e.is_regular_file()) used += e.file_size();
+  }
+  info = FSInfo{ host_fs_total, used, 8192, 256, 5, 32 };
+  return true;
+}
+
+HardwareSerial Serial;
+EspClass       ESP;
+TwoWire        Wire;
+fs::FS         LittleFS;
+WiFiClass      WiFi;
+MDNSClass      MDNS;
@@ -0,0 +1,13 @@
+#pragma once
+#include "../Arduino.h"
+
+class Uri {
+ public:
+  String pattern;
+  Uri(const char* s) : pattern(s) {}
+};
+
+class UriRegex : public Uri {
+ public:
+  explicit UriRegex(const char* s) : Uri(s) {}
+};
@@ -0,0 +1,120 @@
+// Bounded latency of the acquisition engine: every loop() pass, and so every
+// acq_step() call, does at most one I2C transaction, whatever the sensors
+// and muxes do. Also checks the bus time per pass and that read cycles keep
+// up with ACQ_RATE_HZ.
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static uint8_t missing_channel = 0xFF;   // Sensor on this channel does not ACK
+
+static bool sensor(uint8_t, uint8_t channel, uint8_t, int16_t& flow, int16_t& temp) {
+  if (channel == missing_channel) return false;
+  flow = host_default_flow;
+  temp = host_default_temp;
+  return true;
+}
+
+// Bus time of the longest single transaction, a sensor read
+static constexpr uint32_t READ_US = I2C_BITS_READ * 1000000UL / I2C_CLOCK_HZ;
+
+struct PassStats {
+  uint32_t passes = 0;
+  uint32_t transactions = 0;
+  uint32_t max_per_pass = 0;
+  uint32_t hist[4] = {};      // Bus us per pass: 0, <= 1/4, <= 1/2, <= 1 read
+  uint64_t max_us = 0;
+};
+
+// Run loop() for `ms`, recording transactions and bus time of every pass
+static PassStats run_passes(uint32_t ms) {
+  PassStats st;
+  uint64_t until = host_time_us + (uint64_t)ms * 1000;
+  while (host_time_us < until) {
+    uint32_t n0 = host_i2c_transactions;
+    uint64_t bus0 = host_i2c_bus_us;
+    loop();
+    uint32_t n = host_i2c_transactions - n0;
+    uint64_t us = host_i2c_bus_us - bus0;
+    st.passes++;
+    st.transactions += n;
+    st.max_per_pass = std::max(st.max_per_pass, n);
+    st.max_us = std::max(st.max_us, us);
+    st.hist[us == 0 ? 0 : us * 4 <= READ_US ? 1 : us * 2 <= READ_US ? 2 : 3]++;
+    host_time_us += HOST_PASS_US;
+  }
+  return st;
+}
+
+static void report(const char* name, const PassStats& st) {
+  printf("%-16s passes %7u  transactions %7u  max/pass %u  max bus %3llu us  "
+         "bus us/pass [0] %u (0,%u] %u (%u,%u] %u (%u,%u] %u\n",
+         name, st.passes, st.transactions, st.max_per_pass, (unsigned long long)st.max_us,
+         st.hist[0], READ_US / 4, st.hist[1], READ_US / 4, READ_US / 2, st.hist[2],
+         READ_US / 2, READ_US, st.hist[3]);
+}
+
+// Every pass: one transaction at most, never longer on the bus than a read
+static void check_bounded(const PassStats& st) {
+  CHECK(st.max_per_pass <= 1);
+  CHECK(st.max_us <= READ_US);
+}
+
+int main() {
+  host_sensor_read = sensor;
+  host_boot("test_acq_latency");
+
+  // Start command and warm-up
+  PassStats st = run_passes(1000);
+  report("start", st);
+  check_bounded(st);
+
+  // Steady state: a full read cycle every acquisition period, no ticks lost
+  uint32_t skipped0 = _acq.skipped;
+  uint32_t seq0 = s_seq;
+  st = run_passes(10000);
+  report("steady", st);
+  check_bounded(st);
+  CHECK(_acq.skipped == skipped0);
+  CHECK(s_seq - seq0 == 10000 / SAMPLE_MS);
+  // Reads of every sensor, the mux writes between them and the idle passes
+  uint32_t cycles = 10000 * 1000 / ACQ_PERIOD_US;
+  CHECK(st.transactions >= cycles * NUM_SENSORS);
+  CHECK(st.passes - st.hist[0] == st.transactions);
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) CHECK(s_ok[i]);
+
+  // A sensor that stops answering costs a failed read, not a longer pass
+  missing_channel = SENSOR_TOPOLOGY[NUM_SENSORS - 1].channel;
+  st = run_passes(2000);
+  report("sensor missing", st);
+  check_bounded(st);
+  CHECK(!s_ok[NUM_SENSORS - 1]);
+  CHECK(s_ok[0]);
+  missing_channel = 0xFF;
+  st = run_passes(1000);
+  check_bounded(st);
+  CHECK(s_ok[NUM_SENSORS - 1]);
+
+  // No mux on the bus: every select fails, one attempt per pass
+  host_muxes_present = 0;
+  st = run_passes(2000);
+  report("mux missing", st);
+  check_bounded(st);
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) CHECK(!s_ok[i]);
+  host_muxes_present = 0xFF;
+  st = run_passes(1000);
+  check_bounded(st);
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) CHECK(s_ok[i]);
+
+  // Stop and start commands preempt a read cycle, one sensor per pass
+  sensors_stop();
+  st = run_passes(200);
+  check_bounded(st);
+  sensors_start();
+  st = run_passes(1000);
+  report("stop/start", st);
+  check_bounded(st);
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) CHECK(s_ok[i]);
+
+  return host_test_result();
+}
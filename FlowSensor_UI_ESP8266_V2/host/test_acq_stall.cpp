@@ -0,0 +1,76 @@
+// loop() stalls for 3 s (a long web request) while a raw run records. The
+// samples it never took are lost, but not silently: the run file resumes
+// with a gap keyframe on time, run.dropped counts them, and /telemetry
+// reports them to a client that asks from before the stall.
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static const uint32_t STALL_MS = 3000;
+static const uint32_t STALL_SAMPLES = STALL_MS / SAMPLE_MS;
+
+// Times and gap flags of every record of run `id`
+static bool decode_run(uint32_t id, std::vector<uint32_t>& t, std::vector<bool>& gap) {
+  char path[32];
+  run_path(path, sizeof(path), id);
+  File f = LittleFS.open(path, "r");
+  RunFileHeader h;
+  RunScale scales[NUM_SENSORS];
+  if (!f || !run_read_header(f, h, scales)) return false;
+  static RunDecoder dec;
+  dec.begin(f, h);
+  uint32_t t_ms;
+  int16_t w[RUN_WORDS_MAX];
+  while (dec.next(t_ms, w)) {
+    t.push_back(t_ms);
+    gap.push_back(dec.gap);
+  }
+  return true;
+}
+
+int main() {
+  host_boot("test_acq_stall");
+  host_run_ms(1000);
+  _server.request(HTTP_POST, "/start", { { "mode", "raw" } });
+  host_run_ms(5000);
+
+  uint32_t since = s_seq;
+  host_time_us += STALL_MS * 1000ULL;
+  host_run_ms(200);
+
+  // A telemetry client that last saw `since`, right after the stall
+  SampleRange r;
+  get_sample_range(r);
+  TelemetryHeader h;
+  telem_begin(h, r, since, UINT16_MAX);
+  printf("stall: %u samples lost; telemetry flags %u, dropped %u, first %u (since %u)\n",
+         get_samples_lost(), h.flags, h.dropped, h.first_seq, since);
+  CHECK(get_samples_lost() + 1 >= STALL_SAMPLES && get_samples_lost() <= STALL_SAMPLES);
+  CHECK(h.flags & TELEM_GAP);
+  CHECK(h.dropped >= get_samples_lost());
+  CHECK(h.first_seq == since + h.dropped);
+
+  host_run_ms(5000);
+  _server.request(HTTP_POST, "/stop");
+  uint32_t duration = run_index[run_index_slot(run_id)].duration_ms;
+
+  std::vector<uint32_t> t;
+  std::vector<bool> gap;
+  CHECK(decode_run(run_id, t, gap));
+  size_t gaps = 0, at = 0;
+  for (size_t k = 1; k < t.size(); k++) {
+    if (gap[k]) {
+      gaps++;
+      at = k;
+    }
+  }
+  uint32_t jump = at ? t[at] - t[at - 1] : 0;
+  printf("run: %zu records, %u dropped, duration %u ms, last t %u ms, gap of %u ms\n",
+         t.size(), rec_dropped, duration, t.empty() ? 0 : t.back(), jump);
+  CHECK(rec_dropped == get_samples_lost());
+  CHECK(gaps == 1);
+  CHECK(jump + SAMPLE_MS >= STALL_MS && jump <= STALL_MS + 2 * SAMPLE_MS);
+  CHECK(!t.empty() && t.back() + 2 * SAMPLE_MS >= duration && t.back() <= duration);
+  CHECK(t.size() + rec_dropped + 2 >= duration / SAMPLE_MS);
+  return host_test_result();
+}
@@ -0,0 +1,73 @@
+// Saving triggered captures when flash writes fail: at file creation,
+// halfway through the file, and on the last block. The capture must leave
+// no file behind, be listed in /events as not saved and count in
+// events_skipped, and the next capture must save normally.
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static uint32_t captures = 0;
+
+// Fire a low-flow trigger on sensor 1 and run until the capture is through
+static EventEntry capture() {
+  _server.request(HTTP_POST, "/events/trigger/1", { { "low", "off" } });
+  host_run_ms(100);
+  _server.request(HTTP_POST, "/events/trigger/1", { { "low", "1000" } });
+  host_run_ms((EVENT_POST_SAMPLES + 20) * SAMPLE_MS);
+  captures++;
+  EventEntry e = {};
+  CHECK(get_event_entry(captures, e));
+  CHECK(event_state == EVENT_ARMED);
+  return e;
+}
+
+static bool file_exists(uint32_t id) {
+  char path[32];
+  event_path(path, sizeof(path), id);
+  return LittleFS.exists(path);
+}
+
+// A capture with writes failing after `budget` bytes
+static void failing_capture(const char* name, size_t budget) {
+  uint32_t missed, skipped0, skipped;
+  get_event_stats(missed, skipped0);
+  host_fs_write_budget = budget;
+  EventEntry e = capture();
+  host_fs_write_budget = SIZE_MAX;
+  get_event_stats(missed, skipped);
+  printf("%-14s event %u: unsaved %u, %u records, file %s\n", name, e.id, e.unsaved, e.records,
+         file_exists(e.id) ? "left behind" : "removed");
+  CHECK(e.unsaved && e.records == 0 && e.bytes == 0);
+  CHECK(!file_exists(e.id));
+  CHECK(skipped == skipped0 + 1);
+  CHECK(_server.request(HTTP_GET, "/events/" + std::to_string(e.id)) == 404);
+}
+
+static void good_capture() {
+  EventEntry e = capture();
+  printf("%-14s event %u: unsaved %u, %u records, %u bytes\n", "saved", e.id, e.unsaved, e.records, e.bytes);
+  CHECK(!e.unsaved && e.records == EVENT_PRE_SAMPLES + EVENT_POST_SAMPLES);
+  CHECK(file_exists(e.id));
+  CHECK(_server.request(HTTP_GET, "/events/" + std::to_string(e.id)) == 200);
+}
+
+int main() {
+  host_boot("test_event_save");
+  host_run_ms(10000);   // A full pre-trigger window in the ring
+
+  good_capture();
+  size_t file_bytes = event_index[event_index_slot(1)].bytes;
+  failing_capture("at creation", 0);
+  failing_capture("halfway", RUN_WRITE_BUF + 10);
+  failing_capture("last block", file_bytes - 1);
+  good_capture();
+
+  // Listed oldest first, the failed ones marked
+  CHECK(_server.request(HTTP_GET, "/events") == 200);
+  const std::string& body = _server.response.body;
+  size_t unsaved = 0;
+  for (size_t p = 0; (p = body.find("\"saved\":false", p)) != std::string::npos; p++) unsaved++;
+  CHECK(unsaved == 3);
+  CHECK(body.find("\"id\":1,") < body.find("\"id\":5,"));
+  return host_test_result();
+}
@@ -0,0 +1,66 @@
+// An error trigger armed on a sensor that is switched off and on again:
+// the samples while its filter refills are not OK, but must not fire the
+// trigger. A sensor that really stops answering, switched on or not, must.
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static bool unplugged = false;   // Sensor 2 (mux 0, channel 1) does not answer
+
+static bool sensor(uint8_t mux, uint8_t channel, uint8_t addr, int16_t& flow, int16_t& temp) {
+  flow = host_default_flow;
+  temp = host_default_temp;
+  return !(unplugged && channel == 1);
+}
+
+static uint32_t events_saved() {
+  uint32_t n = 0;
+  EventEntry e;
+  for (uint32_t id = 1; id <= EVENT_SLOTS; id++) n += get_event_entry(id, e);
+  return n;
+}
+
+// Switch sensor 2 off and on again, then run `ms`; true if it reads OK after
+static bool toggle(uint32_t ms) {
+  _server.request(HTTP_POST, "/sensor/2/off");
+  host_run_ms(1000);
+  _server.request(HTTP_POST, "/sensor/2/on");
+  host_run_ms(ms);
+  return _acq.output[1].ok;
+}
+
+int main() {
+  host_sensor_read = sensor;
+  host_boot("test_event_settle");
+  host_run_ms(10000);   // A full pre-trigger window in the ring
+  CHECK(_server.request(HTTP_POST, "/events/trigger/2", { { "error", "1" } }) == 200);
+  host_run_ms(1000);
+
+  // Switched off and on: no event
+  bool ok = toggle(2000);
+  uint32_t missed, skipped;
+  get_event_stats(missed, skipped);
+  printf("off/on: sensor ok %d, events %u, state %d, missed %u\n", ok, events_saved(), event_state, missed);
+  CHECK(ok);
+  CHECK(event_state == EVENT_ARMED && events_saved() == 0 && missed == 0);
+
+  // Switched on without answering: an error event for sensor 2
+  unplugged = true;
+  toggle((EVENT_POST_SAMPLES + 20) * SAMPLE_MS);
+  EventEntry e = {};
+  bool fired = get_event_entry(1, e);
+  printf("unplugged, off/on: event %d, sensor %u, cause %s\n", fired, e.sensor + 1,
+         fired ? EVENT_CAUSE_NAMES[e.cause] : "-");
+  CHECK(fired && e.sensor == 1 && e.cause == EVENT_ERROR);
+
+  // Replugged, then failing while on: an error event again
+  unplugged = false;
+  host_run_ms(2000);
+  unplugged = true;
+  host_run_ms((EVENT_POST_SAMPLES + 20) * SAMPLE_MS);
+  fired = get_event_entry(2, e);
+  printf("unplugged while on: event %d, sensor %u, cause %s\n", fired, e.sensor + 1,
+         fired ? EVENT_CAUSE_NAMES[e.cause] : "-");
+  CHECK(fired && e.sensor == 1 && e.cause == EVENT_ERROR);
+  return host_test_result();
+}
@@ -0,0 +1,77 @@
+// A /history response over a long run takes longer than the sample ring
+// holds: every record is read from flash and bucketed, and the client
+// drains the socket slowly. Recording in progress must lose nothing
+// meanwhile, in either mode.
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static const uint32_t HISTORY_RECORDS = 150000;   // 2 h of raw samples
+
+// A finished raw run, then its file replaced by HISTORY_RECORDS records
+static uint32_t make_long_run() {
+  _server.request(HTTP_POST, "/start", { { "mode", "raw" } });
+  host_run_ms(2000);
+  _server.request(HTTP_POST, "/stop");
+
+  char path[32];
+  run_path(path, sizeof(path), run_id);
+  File f = LittleFS.open(path, "r");
+  std::vector<uint8_t> head(run_data_offset(NUM_SENSORS));
+  f.read(head.data(), head.size());
+  f.close();
+
+  f = LittleFS.open(path, "w");
+  f.write(head.data(), head.size());
+  RunEncoder enc;
+  enc.reset();
+  uint8_t rec[RUN_ENCODED_MAX];
+  int16_t w[RUN_WORDS_MAX];
+  for (uint32_t k = 0; k < HISTORY_RECORDS; k++) {
+    for (int i = 0; i < 2 * NUM_SENSORS; i++) w[i] = (int16_t)(i % 2 ? 4600 : 6000 + (k * 7 + i * 13) % 41);
+    f.write(rec, enc.encode(rec, k * SAMPLE_MS, w, 2 * NUM_SENSORS));
+  }
+  f.close();
+  run_index[run_index_slot(run_id)].duration_ms = HISTORY_RECORDS * SAMPLE_MS;
+  return run_id;
+}
+
+static void stream_while_recording(uint32_t history_run, RecordMode mode) {
+  _server.request(HTTP_POST, "/start", { { "mode", mode == RECORD_RAW ? "raw" : "avg" } });
+  host_run_ms(5000);
+  uint32_t records0 = run_writer.records;
+  uint32_t seq0 = s_seq;
+  uint64_t t0 = host_time_us;
+
+  // 512-byte reads take 8 ms, 1 kB sends 8 ms: acquisition runs between them
+  host_fs_read_us_per_byte = 16;
+  host_link_us_per_byte = 8;
+  char run[12];
+  snprintf(run, sizeof(run), "%u", history_run);
+  CHECK(_server.request(HTTP_GET, "/history", { { "run", run }, { "points", "1000" } }) == 200);
+  host_fs_read_us_per_byte = 0;
+  host_link_us_per_byte = 0;
+  double seconds = (host_time_us - t0) / 1e6;
+  uint32_t samples = s_seq - seq0;
+
+  host_run_ms(5000);
+  // Raw: every sample. Avg: one record per RECORD_MS, one either way for the phase.
+  uint32_t got = run_writer.records - records0;
+  uint32_t expected = mode == RECORD_RAW ? s_seq - seq0 : (host_time_us - t0) / 1000 / RECORD_MS;
+  printf("%s: /history took %.1f s, %u samples meanwhile; %u records written, %u expected, %u dropped\n",
+         mode == RECORD_RAW ? "raw" : "avg", seconds, samples, got, expected, rec_dropped);
+  CHECK(samples > N_HIST);   // Long enough to overrun the ring
+  CHECK(got + 1 >= expected && got <= expected + 1);
+  CHECK(rec_dropped == 0);
+  _server.request(HTTP_POST, "/stop");
+}
+
+int main() {
+  host_boot("test_history_stream");
+  host_fs_total = 16 * 1024 * 1024;
+  host_run_ms(1000);
+  uint32_t id = make_long_run();
+  stream_while_recording(id, RECORD_RAW);
+  stream_while_recording(id, RECORD_AVG);
+  return host_test_result();
+}
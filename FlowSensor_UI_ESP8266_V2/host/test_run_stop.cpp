@@ -0,0 +1,89 @@
+// A reset at any point of stopping a run leaves a consistent state: either
+// the run resumes from its last checkpoint, or it is finished with an
+// index entry that matches its file. Each reset point is reached by doing
+// the steps of stop_run() up to it, then reloading the index and running
+// recovery as setup() does.
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static void reset_device() {
+  recording = false;
+  runs_begin();
+  recover_run();
+}
+
+// Records in run `id` and its file size
+static uint32_t run_records(uint32_t id, size_t& size) {
+  char path[32];
+  run_path(path, sizeof(path), id);
+  File f = LittleFS.open(path, "r");
+  size = f ? f.size() : 0;
+  RunFileHeader h;
+  RunScale scales[NUM_SENSORS];
+  if (!f || !run_read_header(f, h, scales)) return 0;
+  static RunDecoder dec;
+  dec.begin(f, h);
+  uint32_t n = 0, t_ms;
+  int16_t w[RUN_WORDS_MAX];
+  while (dec.next(t_ms, w)) n++;
+  return n;
+}
+
+// The index entry of `id` describes its file exactly, and nothing resumes
+static void check_finished(const char* point, uint32_t id) {
+  RunJournal j;
+  RunIndexEntry e = {};
+  size_t size;
+  uint32_t records = run_records(id, size);
+  bool listed = get_run_entry(id, e);
+  printf("%-22s run %u: recording %d, journal %d, index %u records %u bytes, file %u records %zu bytes\n",
+         point, id, recording, run_journal_load(j), e.records, e.bytes, records, size);
+  CHECK(!recording && !run_journal_load(j));
+  CHECK(listed && e.records == records && e.bytes == size && e.duration_ms > 0);
+}
+
+static uint32_t record(uint32_t ms) {
+  _server.request(HTTP_POST, "/start", { { "mode", "raw" } });
+  host_run_ms(ms);
+  return run_id;
+}
+
+int main() {
+  host_boot("test_run_stop");
+  host_run_ms(1000);
+
+  // Stopped normally
+  uint32_t id = record(15000);
+  stop_run();
+  reset_device();
+  check_finished("stopped", id);
+
+  // Reset after the file was closed, before the index entry was stored:
+  // the run resumes from its last checkpoint
+  id = record(15000);
+  while (rec_next_seq != s_seq) record_raw_samples();
+  recording = false;
+  run_writer.close();
+  reset_device();
+  printf("%-22s run %u: recording %d (run %u)\n", "reset before index", id, recording, run_id);
+  CHECK(recording && run_id == id);
+  host_run_ms(2000);
+  stop_run();
+  check_finished("  then stopped", id);
+
+  // Reset after the index entry was stored, before the journal was
+  // cleared: the run stays finished
+  id = record(15000);
+  while (rec_next_seq != s_seq) record_raw_samples();
+  recording = false;
+  run_writer.close();
+  uint8_t slot = run_index_slot(id);
+  run_index[slot].duration_ms = millis() - run_start_ms;
+  run_index[slot].bytes       = run_writer.bytes;
+  run_index[slot].records     = run_writer.records;
+  run_index_store(run_index, slot);
+  reset_device();
+  check_finished("reset before journal", id);
+  return host_test_result();
+}
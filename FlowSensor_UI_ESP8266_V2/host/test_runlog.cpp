@@ -0,0 +1,194 @@
+// Run file decoding (runlog.h): round trip, files cut at every byte, random
+// corruption, and the bounds of the varint reader; index writes cut short. Built with AddressSanitizer
+// when HOST_SANITIZE is on, so a read past a buffer fails the test.
+#include <random>
+#include <vector>
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static const char* PATH = "/test.bin";
+static const uint64_t MASK = (1ULL << NUM_SENSORS) - 1 - 2;   // Every sensor but the second
+static const uint8_t WORDS = 2 * (NUM_SENSORS - 1);
+
+struct Record {
+  uint32_t t_ms;
+  int16_t  w[RUN_WORDS_MAX];
+};
+
+static RunFileHeader header() {
+  return RunFileHeader{ RUN_MAGIC, RUN_VERSION, NUM_SENSORS, 50, MASK };
+}
+
+// Encoded file, and the file offset each record ends at
+static std::vector<uint8_t> encode(const std::vector<Record>& recs, std::vector<size_t>& ends) {
+  std::vector<uint8_t> file(run_data_offset(NUM_SENSORS));
+  RunFileHeader h = header();
+  memcpy(file.data(), &h, sizeof(h));
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    RunScale sc = { FLOW_SCALE, TEMP_SCALE };
+    memcpy(file.data() + sizeof(h) + i * sizeof(sc), &sc, sizeof(sc));
+  }
+  RunEncoder enc;
+  enc.reset();
+  uint8_t rec[RUN_ENCODED_MAX];
+  for (const Record& r : recs) {
+    size_t n = enc.encode(rec, r.t_ms, r.w, WORDS);
+    file.insert(file.end(), rec, rec + n);
+    ends.push_back(file.size());
+  }
+  return file;
+}
+
+static void store(const uint8_t* data, size_t n) {
+  File f = LittleFS.open(PATH, "w");
+  f.write(data, n);
+  f.close();
+}
+
+// Decode the stored file; false if the header was rejected
+static bool decode(std::vector<Record>& out) {
+  out.clear();
+  File f = LittleFS.open(PATH, "r");
+  RunFileHeader h;
+  RunScale scales[NUM_SENSORS];
+  if (!run_read_header(f, h, scales)) {
+    f.close();
+    return false;
+  }
+  static RunDecoder dec;
+  dec.begin(f, h);
+  Record r;
+  while (dec.next(r.t_ms, r.w)) {
+    out.push_back(r);
+    if (out.size() > 1000000) break;   // Never stops: caught by the caller
+  }
+  f.close();
+  return true;
+}
+
+static bool same(const Record& a, const Record& b) {
+  return a.t_ms == b.t_ms && !memcmp(a.w, b.w, 2 * WORDS);
+}
+
+// run_get_varint() on heap buffers of the exact size, so ASan sees any overrun
+static void check_varints() {
+  auto get = [](std::vector<uint8_t> bytes, size_t& n) {
+    uint8_t* p = new uint8_t[bytes.size()];
+    if (!bytes.empty()) memcpy(p, bytes.data(), bytes.size());
+    uint32_t v = 0;
+    n = run_get_varint(p, bytes.size(), v);
+    delete[] p;
+    return v;
+  };
+  size_t n;
+  CHECK(get({ 0x05 }, n) == 5 && n == 1);
+  CHECK(get({ 0xFF, 0xFF, 0xFF, 0xFF, 0x0F }, n) == 0xFFFFFFFFu && n == 5);
+  get({ 0x80, 0x80 }, n);
+  CHECK(n == 0);   // Runs off the end
+  get({ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 }, n);
+  CHECK(n == 0);   // Longer than 5 bytes
+  get({}, n);
+  CHECK(n == 0);
+}
+
+// Index slot writes that fail or are cut short are reported, and a run
+// whose index entry cannot be written does not start
+static void check_index_store() {
+  const char* idx = "/test_index.bin";
+  const size_t size = sizeof(RunIndexEntry) * RUN_INDEX_SLOTS;
+  static RunIndexEntry entries[RUN_INDEX_SLOTS];
+  entries[3].id = 3;
+  host_fs_write_budget = size - 1;
+  CHECK(!index_file_store(idx, entries, size, 3, sizeof(RunIndexEntry)));
+  LittleFS.remove(idx);
+  host_fs_write_budget = SIZE_MAX;
+  CHECK(index_file_store(idx, entries, size, 3, sizeof(RunIndexEntry)));
+  host_fs_write_budget = sizeof(RunIndexEntry) - 1;
+  CHECK(!index_file_store(idx, entries, size, 3, sizeof(RunIndexEntry)));
+  host_fs_write_budget = SIZE_MAX;
+  CHECK(index_file_store(idx, entries, size, 3, sizeof(RunIndexEntry)));
+
+  // The run file header fits, its index entry does not
+  uint32_t id = get_next_run_id();
+  char path[32];
+  run_path(path, sizeof(path), id);
+  host_fs_write_budget = run_data_offset(NUM_SENSORS);
+  _server.request(HTTP_POST, "/start");
+  host_fs_write_budget = SIZE_MAX;
+  printf("index write fails at start: recording %d, run file %s\n", recording,
+         LittleFS.exists(path) ? "left behind" : "removed");
+  CHECK(!recording && !LittleFS.exists(path) && get_next_run_id() == id);
+}
+
+int main() {
+  host_boot("test_runlog");
+  check_varints();
+  check_index_store();
+
+  // Smooth flow with steps and full-scale jumps, so deltas of every varint
+  // length occur, and irregular time steps
+  std::mt19937 rng(7);
+  std::vector<Record> recs(1000);
+  int16_t level = 6000;
+  uint32_t t = 0;
+  for (Record& r : recs) {
+    if (rng() % 50 == 0) level = (int16_t)(rng() % 65536 - 32768);
+    t += (rng() % 20 == 0) ? 50 + rng() % 100000 : 50;
+    r.t_ms = t;
+    for (int k = 0; k < WORDS; k++) r.w[k] = (int16_t)(k % 2 ? 4600 + rng() % 3 : level + rng() % 41 - 20);
+  }
+  std::vector<size_t> ends;
+  std::vector<uint8_t> file = encode(recs, ends);
+
+  // Round trip
+  std::vector<Record> out;
+  store(file.data(), file.size());
+  CHECK(decode(out));
+  CHECK(out.size() == recs.size());
+  bool all_same = out.size() == recs.size();
+  for (size_t i = 0; all_same && i < out.size(); i++) all_same = same(out[i], recs[i]);
+  CHECK(all_same);
+
+  // Cut at every length: exactly the records that are complete come back
+  uint32_t cut_errors = 0;
+  for (size_t cut = run_data_offset(NUM_SENSORS); cut <= file.size(); cut++) {
+    store(file.data(), cut);
+    decode(out);
+    size_t complete = std::upper_bound(ends.begin(), ends.end(), cut) - ends.begin();
+    if (out.size() != complete) cut_errors++;
+    for (size_t i = 0; i < out.size() && i < recs.size(); i++) {
+      if (!same(out[i], recs[i])) {
+        cut_errors++;
+        break;
+      }
+    }
+  }
+  printf("%zu records, %zu bytes, every cut length decoded: %u errors\n", recs.size(), file.size(), cut_errors);
+  CHECK(cut_errors == 0);
+
+  // Corrupt bytes and continuation-bit runs: decoding must end without
+  // reading past its buffer, with at most one record per byte
+  uint32_t trials = 0;
+  for (int trial = 0; trial < 2000; trial++) {
+    std::vector<uint8_t> bad = file;
+    size_t from = run_data_offset(NUM_SENSORS) + rng() % (file.size() - run_data_offset(NUM_SENSORS));
+    size_t count = 1 + rng() % (trial % 2 ? 8 : 600);
+    for (size_t k = from; k < std::min(bad.size(), from + count); k++) bad[k] = trial % 3 ? (uint8_t)rng() : 0xFF;
+    store(bad.data(), bad.size());
+    CHECK(decode(out));
+    CHECK(out.size() <= bad.size());
+    trials++;
+  }
+  printf("%u corrupted files decoded\n", trials);
+
+  // A sensor mask naming sensors beyond the table is rejected
+  RunFileHeader h = header();
+  h.num_sensors = NUM_SENSORS - 1;
+  h.sensor_mask = 1ULL << (NUM_SENSORS - 1);
+  memcpy(file.data(), &h, sizeof(h));
+  store(file.data(), file.size());
+  CHECK(!decode(out));
+
+  return host_test_result();
+}
@@ -0,0 +1,38 @@
+// Pulsation of known frequency and amplitude on every sensor, read at the
+// acquisition rate through the decimator: /api must report the frequency,
+// and the amplitude of the flow itself rather than what is left of it
+// after the filter (half of it at 7.5 Hz).
+#include <cmath>
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static const float PULSE_HZ[] = { 0.7f, 2.0f, 3.3f, 7.5f };
+static const float PULSE_AMP  = 1.0f;   // mL/min, peak
+
+static bool sensor(uint8_t mux, uint8_t channel, uint8_t addr, int16_t& flow, int16_t& temp) {
+  double t = host_time_us / 1e6;
+  double hz = PULSE_HZ[channel % 4];
+  flow = (int16_t)lround(host_default_flow + PULSE_AMP * FLOW_SCALE * sin(2 * M_PI * hz * t));
+  temp = host_default_temp;
+  return true;
+}
+
+int main() {
+  host_sensor_read = sensor;
+  host_boot("test_spectrum");
+  // A full FFT window in the ring, then one transform per sensor
+  host_run_ms(FFT_N * SAMPLE_MS + 2000 * NUM_SENSORS);
+
+  float hz[NUM_SENSORS], amp[NUM_SENSORS];
+  get_pulsation(hz, amp);
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    float f = PULSE_HZ[i % 4];
+    float filter = CicDecimator<CIC_ORDER, ACQ_DECIMATION>::response(f / ACQ_RATE_HZ);
+    printf("sensor %d: %.2f Hz at %.2f Hz, amplitude %.3f of %.3f mL/min (filter passes %.3f)\n",
+           i + 1, hz[i], f, amp[i], PULSE_AMP, filter);
+    CHECK(fabsf(hz[i] - f) < 0.05f);
+    CHECK(fabsf(amp[i] - PULSE_AMP) < 0.03f * PULSE_AMP);
+  }
+  return host_test_result();
+}
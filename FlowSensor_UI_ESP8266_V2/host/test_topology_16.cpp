@@ -0,0 +1,36 @@
+// The sketch built for 16 sensors on two muxes (topology_16.h): it must
+// compile within the RAM and bus budgets, read every sensor, keep up with a
+// raw recording and serve /api and /trend.
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+static_assert(NUM_SENSORS == 16 && NUM_MUXES == 2, "Built with the wrong topology");
+
+int main() {
+  host_boot("test_topology_16");
+  host_run_ms(2000);
+
+  // Read cycles keep up once the start command is through
+  _server.request(HTTP_POST, "/start", { { "mode", "raw" } });
+  host_run_ms(100);
+  uint32_t skipped0 = _acq.skipped;
+  host_run_ms(10000);
+  _server.request(HTTP_POST, "/stop");
+  uint32_t all_ok = 0;
+  for (int i = 0; i < NUM_SENSORS; i++) all_ok += _acq.output[i].ok;
+  printf("%d sensors on %d muxes: %u reading, %u trend buckets per tier, bus %.1f%% (max %.1f%%), "
+         "%u raw records, %u dropped\n",
+         NUM_SENSORS, NUM_MUXES, all_ok, TREND_SLOTS, _acq.bus_util_pct, _acq.bus_util_max_pct,
+         run_writer.records, rec_dropped);
+  CHECK(all_ok == NUM_SENSORS);
+  CHECK(_acq.skipped == skipped0);
+  CHECK(rec_dropped == 0);
+  CHECK(run_writer.records >= 10000 / SAMPLE_MS);
+
+  CHECK(_server.request(HTTP_GET, "/api") == 200);
+  CHECK(_server.response.body.find("\"s16\":{") != std::string::npos);
+  CHECK(_server.request(HTTP_GET, "/trend", { { "tier", "0" } }) == 200);
+  CHECK(_server.response.body.find("\"s16\":{") != std::string::npos);
+  return host_test_result();
+}
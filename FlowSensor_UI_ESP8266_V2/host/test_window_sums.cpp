@@ -0,0 +1,152 @@
+// The O(1) running window sums (s_win) against a brute-force recomputation
+// over a long run: many ring wrap-arounds, full-scale and negative words,
+// reads failing and sensors disabled and re-enabled, and a buffer reset in
+// between. Also checks the held values and s_ok_hist bits in the ring and the
+// 10 s mean / RMS / CV derived from the sums.
+#include <deque>
+#include <random>
+#include <vector>
+#include "FlowSensor_UI_ESP8266.ino"
+#include "host_sim.h"
+#include "host_test.h"
+
+struct RefSample {
+  int16_t flow[NUM_SENSORS];
+  int16_t temp[NUM_SENSORS];
+  bool    ok[NUM_SENSORS];
+};
+
+static std::deque<RefSample> ref;   // Newest last, at most N_HIST
+static RefSample held;              // Last stored words per sensor
+
+static void ref_reset() {
+  ref.clear();
+  memset(&held, 0, sizeof(held));
+}
+
+// What push_sample() should store: the new words if read, else the held ones
+static void ref_push(const FlowReading in[]) {
+  RefSample s;
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    s.ok[i] = in[i].enabled && in[i].ok;
+    if (s.ok[i]) {
+      held.flow[i] = in[i].flow_raw;
+      held.temp[i] = in[i].temp_raw;
+    }
+    s.flow[i] = held.flow[i];
+    s.temp[i] = held.temp[i];
+  }
+  ref.push_back(s);
+  if (ref.size() > N_HIST) ref.pop_front();
+}
+
+static uint32_t mismatches = 0;
+
+static void check_against_ref() {
+  // Ring contents and ok bits, newest first
+  for (size_t k = 0; k < ref.size(); k++) {
+    const RefSample& s = ref[ref.size() - 1 - k];
+    int slot = wrap(buf_idx - (int)k);
+    for (int i = 0; i < NUM_SENSORS; i++) {
+      bool bit = (s_ok_hist[slot][i / 8] >> (i % 8)) & 1;
+      if (s_flow_buf[i][slot] != s.flow[i] || s_temp_buf[i][slot] != s.temp[i] || bit != s.ok[i]) mismatches++;
+    }
+  }
+  CHECK(buf_count == (int)ref.size());
+
+  // Window sums, exactly
+  for (int w = 0; w < NUM_WINDOWS; w++) {
+    int n = window_count((StatWindow)w);
+    CHECK(n == std::min((int)ref.size(), WINDOW_LEN[w]));
+    for (int i = 0; i < NUM_SENSORS; i++) {
+      int64_t flow = 0, flow_sq = 0, temp = 0;
+      for (int k = 0; k < n; k++) {
+        const RefSample& s = ref[ref.size() - 1 - k];
+        flow    += s.flow[i];
+        flow_sq += (int64_t)s.flow[i] * s.flow[i];
+        temp    += s.temp[i];
+      }
+      const WindowSums& ws = s_win[i][w];
+      if (ws.flow != flow || ws.flow_sq != flow_sq || ws.temp != temp) mismatches++;
+    }
+  }
+}
+
+static bool close_to(double a, double b) {
+  return fabs(a - b) <= 1e-4 * std::max(1.0, fabs(b));
+}
+
+// 10 s mean, RMS and CV against the textbook two-pass formulas
+static void check_metrics() {
+  float mean10[NUM_SENSORS], rms10[NUM_SENSORS], cv10[NUM_SENSORS];
+  compute_10s_metrics(mean10, rms10, cv10);
+  int n = window_count(WIN_10S);
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    double scale = SENSOR_TOPOLOGY[i].flow_scale;
+    double sum = 0, sum_sq = 0;
+    for (int k = 0; k < n; k++) sum += ref[ref.size() - 1 - k].flow[i] / scale;
+    double m = n ? sum / n : 0;
+    double var = 0;
+    for (int k = 0; k < n; k++) {
+      double x = ref[ref.size() - 1 - k].flow[i] / scale;
+      sum_sq += x * x;
+      var += (x - m) * (x - m);
+    }
+    double rms = n ? sqrt(sum_sq / n) : 0;
+    double cv = (n == 0 || m < CV_MEAN_EPS) ? 0 : 100.0 * sqrt(var / n) / m;
+    CHECK(close_to(mean10[i], m));
+    CHECK(close_to(rms10[i], rms));
+    CHECK(close_to(cv10[i], cv));
+  }
+}
+
+int main() {
+  host_boot("test_window_sums");
+  reset_buffers();
+  ref_reset();
+
+  std::mt19937 rng(12345);
+  auto uniform = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+  int16_t level[NUM_SENSORS];
+  bool enabled[NUM_SENSORS];
+  for (int i = 0; i < NUM_SENSORS; i++) {
+    level[i] = 6000;
+    enabled[i] = true;
+  }
+
+  const int SAMPLES = 50 * N_HIST;
+  for (int n = 0; n < SAMPLES; n++) {
+    if (n == SAMPLES / 2) {
+      reset_buffers();
+      ref_reset();
+    }
+
+    FlowReading in[NUM_SENSORS];
+    for (int i = 0; i < NUM_SENSORS; i++) {
+      // Every few hundred samples a new regime: steady, full scale either
+      // way, zero, or a random walk
+      if (uniform(0, 299) == 0) {
+        switch (uniform(0, 4)) {
+          case 0: level[i] = 32767; break;
+          case 1: level[i] = -32768; break;
+          case 2: level[i] = 0; break;
+          default: level[i] = (int16_t)uniform(-2000, 20000); break;
+        }
+      }
+      if (uniform(0, 499) == 0) enabled[i] = !enabled[i];
+      int f = level[i] + (abs(level[i]) < 30000 ? uniform(-200, 200) : 0);
+      in[i].flow_raw = (int16_t)constrain(f, -32768, 32767);
+      in[i].temp_raw = (int16_t)uniform(20 * 200, 30 * 200);
+      in[i].ok       = uniform(0, 19) != 0;    // 5% failed reads
+      in[i].enabled  = enabled[i];
+    }
+    push_sample(in);
+    ref_push(in);
+    check_against_ref();
+    if (n % 37 == 0) check_metrics();
+  }
+
+  printf("%d samples (%d ring wraps), %u mismatches\n", SAMPLES, SAMPLES / N_HIST, mismatches);
+  CHECK(mismatches == 0);
+  return host_test_result();
+}
@@ -0,0 +1,11 @@
+// Two fully populated muxes, for test_topology_16 (see sensors.h)
+static constexpr SensorSlot SENSOR_TOPOLOGY[] = {
+  { 0, 0, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE }, { 0, 1, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 0, 2, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE }, { 0, 3, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 0, 4, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE }, { 0, 5, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 0, 6, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE }, { 0, 7, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 1, 0, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE }, { 1, 1, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 1, 2, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE }, { 1, 3, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 1, 4, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE }, { 1, 5, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+  { 1, 6, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE }, { 1, 7, SLF3X_ADDR, FLOW_SCALE, TEMP_SCALE },
+};
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Generate page_gz.h: the dashboard page from web.h, gzipped for PROGMEM.
+
+Expands _PAGE_INDEX exactly as the compiler does (raw string pieces joined
+with STR(MACRO) values from the #defines in web.h), gzips it with a fixed
+timestamp so the output only depends on the page, and writes a header with
+the compressed bytes, an ETag and the length/FNV-1a hash of the expanded
+page. web.h checks that hash at compile time, so a page edit without
+re-running this script fails the build.
+
+Usage: python3 tools/gzip_page.py   (run again after every page change)
+"""
+import gzip
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SKETCH = os.path.join(HERE, "..", "FlowSensor_UI_ESP8266")
+WEB_H = os.path.join(SKETCH, "web.h")
+OUT_H = os.path.join(SKETCH, "page_gz.h")
+
+DEFINE_RE = re.compile(r"^\s*#define\s+(\w+)\s+(.+?)\s*(?://.*)?$", re.M)
+PAGE_RE = re.compile(r"static\s+constexpr\s+char\s+_PAGE_INDEX\[\]\s+PROGMEM\s*=")
+PIECE_RE = re.compile(r'\s*(?:R"(\w*)\((.*?)\)\1"|STR\((\w+)\))', re.S)
+
+
+def fnv1a(data):
+    h = 0x811C9DC5
+    for b in data:
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def expand_page(src):
+    defines = dict(DEFINE_RE.findall(src))
+    m = PAGE_RE.search(src)
+    if not m:
+        sys.exit("gzip_page: _PAGE_INDEX not found in web.h")
+    # Raw string pieces and STR() macros up to the terminating ';'
+    pos, out = m.end(), []
+    while not src[pos:].lstrip().startswith(";"):
+        p = PIECE_RE.match(src, pos)
+        if not p:
+            sys.exit("gzip_page: cannot parse _PAGE_INDEX near: " + src[pos:pos + 40])
+        if p.group(3):
+            value = p.group(3)
+            while value in defines:   # STR() stringifies the full expansion
+                value = defines[value]
+            out.append(value)
+        else:
+            out.append(p.group(2))
+        pos = p.end()
+    return "".join(out).encode("utf-8")
+
+
+def main():
+    with open(WEB_H, encoding="utf-8") as f:
+        page = expand_page(f.read())
+    gz = gzip.compress(page, compresslevel=9, mtime=0)
+    h = fnv1a(page)
+
+    lines = [
+        "// Generated by tools/gzip_page.py from _PAGE_INDEX in web.h - do not edit",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "#define PAGE_INDEX_SRC_LEN   %dUL" % len(page),
+        "#define PAGE_INDEX_SRC_HASH  0x%08XUL   // FNV-1a of the expanded page" % h,
+        '#define PAGE_INDEX_ETAG      "\\"%08x\\""' % h,
+        "",
+        "static const uint8_t _PAGE_INDEX_GZ[%d] PROGMEM = {" % len(gz),
+    ]
+    for i in range(0, len(gz), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+    lines.append("};")
+
+    with open(OUT_H, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+    print("page_gz.h: %d -> %d bytes (%.1f%%), hash %08x"
+          % (len(page), len(gz), 100.0 * len(gz) / len(page), h))
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file
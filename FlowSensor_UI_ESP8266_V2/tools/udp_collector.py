@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+"""Reference receiver for the UDP telemetry push (udp_push.h).
+
+Listens for telemetry datagrams (format in telemetry.h), follows every node
+by its address and boot id, and reports per node:
+  - samples received, lost (jumps in first_seq plus samples the node itself
+    dropped) and duplicated or reordered datagrams
+  - end-to-end latency of each sample, from the moment the node took it to
+    the moment its datagram arrived here
+
+Node and host clocks are not synchronised. The node stamps every datagram
+with millis() at send time (sent_ms) and at its newest sample (newest_ms);
+the offset between the clocks is taken from the fastest datagram seen, so
+the network part of the latency is measured above that minimum (on a LAN
+the minimum is well under a millisecond). The batching part, from sample
+to send, comes from the node clock and is exact.
+
+Usage:
+  python3 tools/udp_collector.py [--port 4210] [--group 239.x.y.z]
+  python3 tools/udp_collector.py --simulate 3 --loss 0.02 --duration 20
+--simulate runs stand-in nodes on this host that send to the collector
+over loopback, dropping the given share of datagrams, to check the loss
+and latency accounting without hardware.
+"""
+import argparse
+import random
+import socket
+import struct
+import sys
+import threading
+import time
+
+MAGIC = 0x4C455446          # "FTEL"
+VERSION = 2
+HEADER = struct.Struct("<IBBHIIIHHIII")
+SCALE = struct.Struct("<ff")
+FLAG_GAP = 0x01
+FLAG_RESET = 0x02
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(p / 100.0 * len(values)))]
+
+
+class Node:
+    def __init__(self, boot_id):
+        self.boot_id = boot_id
+        self.next_seq = None
+        self.offset = None          # host time - node time of the fastest datagram (s)
+        self.datagrams = 0
+        self.samples = 0
+        self.lost = 0
+        self.dropped = 0            # Reported by the node (TELEM_GAP)
+        self.duplicates = 0
+        self.restarts = 0
+        self.latency_ms = []        # Per sample, since the last report
+
+    def receive(self, h, arrival):
+        (_, _, _, sample_ms, _, first, _, count, flags, dropped, newest_ms, sent_ms) = h
+        self.datagrams += 1
+        if flags & FLAG_RESET:
+            self.restarts += 1
+        if flags & FLAG_GAP:
+            self.dropped += dropped
+        if self.next_seq is not None and not flags & FLAG_GAP:
+            if first > self.next_seq:
+                self.lost += first - self.next_seq
+            elif first < self.next_seq:
+                self.duplicates += 1
+                return
+        self.next_seq = first + count
+        self.samples += count
+
+        offset = arrival - sent_ms / 1000.0
+        if self.offset is None or offset < self.offset:
+            self.offset = offset
+        network_ms = (offset - self.offset) * 1000.0
+        newest = first + count - 1
+        for seq in range(first, first + count):
+            taken_ms = newest_ms - (newest - seq) * sample_ms
+            self.latency_ms.append((sent_ms - taken_ms) + network_ms)
+
+
+class Collector:
+    def __init__(self, sock):
+        self.sock = sock
+        self.nodes = {}
+        self.rejected = 0
+        self.lock = threading.Lock()
+
+    def run(self, until):
+        self.sock.settimeout(0.2)
+        while time.monotonic() < until:
+            try:
+                data, addr = self.sock.recvfrom(2048)
+            except socket.timeout:
+                continue
+            arrival = time.monotonic()
+            if len(data) < HEADER.size:
+                self.rejected += 1
+                continue
+            h = HEADER.unpack_from(data)
+            magic, version, num_sensors, count = h[0], h[1], h[2], h[7]
+            record = (num_sensors + 7) // 8 + 4 * num_sensors
+            if (magic != MAGIC or version != VERSION
+                    or len(data) != HEADER.size + num_sensors * SCALE.size + count * record):
+                self.rejected += 1
+                continue
+            with self.lock:
+                key = (addr[0], h[4])
+                node = self.nodes.get(key)
+                if node is None:
+                    node = self.nodes[key] = Node(h[4])
+                node.receive(h, arrival)
+
+    def report(self):
+        with self.lock:
+            for (ip, boot_id), n in sorted(self.nodes.items()):
+                total = n.samples + n.lost + n.dropped
+                loss = 100.0 * (n.lost + n.dropped) / total if total else 0.0
+                lat = n.latency_ms
+                print("%-15s boot %08x  samples %7d  lost %5d  node-dropped %5d  (%.2f%%)  "
+                      "dup %d  latency ms p50 %.1f p95 %.1f max %.1f"
+                      % (ip, boot_id, n.samples, n.lost, n.dropped, loss, n.duplicates,
+                         percentile(lat, 50), percentile(lat, 95), max(lat) if lat else 0.0))
+                n.latency_ms = []
+            if self.rejected:
+                print("rejected datagrams: %d" % self.rejected)
+        sys.stdout.flush()
+
+
+def simulate_node(port, loss, until, sensors=4, batch=10, sample_ms=50):
+    """Stand-in node: sends batches like udp_push.h, dropping a share of them."""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    boot_id = random.getrandbits(32)
+    clock0 = time.monotonic() - random.uniform(0, 1000)    # Unrelated node clock
+    seq = 0
+    record = struct.pack("<B", (1 << sensors) - 1) + struct.pack("<hh", 1000, 2000) * sensors
+    scales = SCALE.pack(500.0, 200.0) * sensors
+    start = time.monotonic()
+    while time.monotonic() < until:
+        # Sample `seq + batch - 1` is taken at start + its slot; send right after
+        newest = seq + batch - 1
+        due = start + (newest + 1) * sample_ms / 1000.0
+        time.sleep(max(0.0, due - time.monotonic()))
+        now_ms = int((time.monotonic() - clock0) * 1000)
+        h = HEADER.pack(MAGIC, VERSION, sensors, sample_ms, boot_id, seq, seq + batch,
+                        batch, 0, 0, now_ms, now_ms)
+        if random.random() >= loss:
+            sock.sendto(h + scales + record * batch, ("127.0.0.1", port))
+        seq += batch
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--port", type=int, default=4210)
+    ap.add_argument("--group", help="multicast group to join (UDP_COLLECTOR on the nodes)")
+    ap.add_argument("--interval", type=float, default=5.0, help="report period (s)")
+    ap.add_argument("--duration", type=float, default=0, help="stop after this many seconds")
+    ap.add_argument("--simulate", type=int, default=0, metavar="N", help="run N stand-in nodes locally")
+    ap.add_argument("--loss", type=float, default=0.0, help="datagram loss of the stand-in nodes (0..1)")
+    args = ap.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", args.port))
+    if args.group:
+        mreq = socket.inet_aton(args.group) + socket.inet_aton("0.0.0.0")
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+
+    until = time.monotonic() + (args.duration or float("inf"))
+    collector = Collector(sock)
+    threading.Thread(target=collector.run, args=(until,), daemon=True).start()
+    for _ in range(args.simulate):
+        threading.Thread(target=simulate_node, args=(args.port, args.loss, until),
+                         daemon=True).start()
+
+    print("listening on UDP %d%s" % (args.port, " group " + args.group if args.group else ""))
+    try:
+        while time.monotonic() < until:
+            time.sleep(min(args.interval, max(0.0, until - time.monotonic())))
+            collector.report()
+    except KeyboardInterrupt:
+        collector.report()
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file